@@ -35,12 +35,12 @@ def getMostCubeLikeRepresentation( n ):
         if n % i != 0:
             continue
 
-        n_over_i = n / i
+        n_over_i = n // i
         for j in range( 1, n_over_i + 1 ):
             if n_over_i % j != 0:
                 continue
             
-            k = n_over_i / j
+            k = n_over_i // j
             surfaceArea = 2 * i * j + 2 * i * k + 2 * j * k
             if surfaceArea < minSurfaceArea:
                 minSurfaceArea = surfaceArea
@@ -60,7 +60,7 @@ def parseListFromString( listString ):
         A list of strings.
     """
     newList = listString.strip(" {}").split(",")
-    return map( lambda x: x.strip(), newList )
+    return [ x.strip() for x in newList ]
 
 
 def createDirectory( dirPath, clean=False ):
@@ -136,6 +136,13 @@ class Machine:
         """ Return True if this Machine has a CUDA GPU available."""
         return False
 
+    def getTimerArguments( self ):
+        """ Return a list containing the GEOSX arguments that select the Caliper timer output. """
+        if self.hasCudaGPU():
+            return ["-t", "spot,profile.mpi,profile.cuda"]
+        else:
+            return ["-t", "spot,profile.mpi"]
+
 
 class SlurmMachine( Machine ):
     """ A class that implements a machine that uses Slurm. """
@@ -212,9 +219,60 @@ class LallocMachine( Machine ):
         return True
 
 
-def getMachine():
-    """ Return a Machine object corresponding to the current machine. """
-    hostName = os.environ[ "HOSTNAME" ]
+class LocalMachine( Machine ):
+    """
+    A class that implements a workstation without a scheduler, the jobs are launched directly with mpirun.
+
+    The GEOSX build is not expected to have Caliper, the timings are taken from the timer report printed at the
+    end of the standard output.
+    """
+
+    def getSumbissionCommand( self, nodes, tasks, threadsPerTask, timeLimit ):
+        """
+        Return a list containing the command necessary to launch a job with the given configuration on this machine.
+
+        Args:
+            self: The Machine to get the submission command for.
+            nodes: The number of nodes the job will use, ignored.
+            tasks: The number of tasks in the job.
+            threadsPerTask: The threads per task, may be None if not specified.
+            timeLimit: The time limit of the job in minutes, ignored (the script time limit still applies).
+
+        Returns:
+            A list containing the submission commands.
+        """
+        command = []
+        if threadsPerTask is not None:
+            command += ["env", "OMP_NUM_THREADS={}".format( threadsPerTask )]
+        command += ["mpirun", "-np", tasks]
+
+        return command
+
+    def printProgress( self ):
+        """
+        Print the status of the submission queue, there is no queue on a local machine.
+
+        Args:
+            self: The Machine to get the status of.
+        """
+        pass
+
+    def getTimerArguments( self ):
+        """ Return an empty list, the built-in timers need no argument. """
+        return []
+
+
+def getMachine( machineName=None ):
+    """
+    Return a Machine object corresponding to the current machine.
+
+    Args:
+        machineName: The name of the machine to use, if None it is determined from the host name.
+    """
+    if machineName == "local":
+        return LocalMachine( "local" )
+
+    hostName = os.environ.get( "HOSTNAME", "" ) if machineName is None else machineName
     if hostName.startswith( "quartz" ):
         return SlurmMachine( "quartz" )
     elif hostName.startswith( "lassen" ):
@@ -301,12 +359,10 @@ class Benchmark:
 
         submissionCommand += self.runCommand
 
-        if machine.hasCudaGPU():
-            submissionCommand += ["-t", "spot,profile.mpi,profile.cuda"]
-        else:
-            submissionCommand += ["-t", "spot,profile.mpi"]
-        
-        submissionCommand = map( str, submissionCommand )
+        submissionCommand += machine.getTimerArguments()
+
+
+        submissionCommand = [ str( arg ) for arg in submissionCommand ]
         with open( self.outputFile, "w" ) as outputFile:
             outputFile.write( "{}\n\n".format( " ".join( submissionCommand ) ) )
             self.process = subprocess.Popen( submissionCommand, cwd=self.outputDir, stdout=outputFile, stderr=subprocess.STDOUT )
@@ -350,6 +406,10 @@ class Benchmark:
         if self.getTimingFile() is not None:
             self.status = Status.SUCCESS
             print( "Completed {}".format( self ) )
+        elif jobExited and self.process.returncode == 0:
+            # Without Caliper there is no timing file, the timers are in the output file.
+            self.status = Status.SUCCESS
+            print( "Completed {}".format( self ) )
         elif jobExited:
             self.status = Status.FAILURE
             print( "Failed {}".format( self ) )
@@ -395,7 +455,7 @@ def printProgress( machine, benchmarks, startTime ):
     for benchmark in benchmarks:
         statusCount[ benchmark.status ] += 1
 
-    for status, count in statusCount.iteritems():
+    for status, count in statusCount.items():
         print( "{}: {}".format( status, count ) )
 
     machine.printProgress()
@@ -536,6 +596,8 @@ def main():
     parser.add_argument( "-t", "--timeLimit", type=int, help="Time limit for the entire script in minutes, the default is {}.". format( timeLimit ), default=timeLimit )
     parser.add_argument( "-o", "--timingCollectionDir", help="Directory to copy the timing files to." )
     parser.add_argument( "-e", "--errorCollectionDir", help="Directory to copy the output from any failed runs to." )
+    parser.add_argument( "-m", "--machine", help="The machine to run on ('quartz', 'lassen' or 'local' to run with mpirun), the default is determined from the host name." )
+    parser.add_argument( "-i", "--inputDir", help="Directory containing the benchmark XML files, the default is {}.".format( benchmarkDir ), default=benchmarkDir )
     args = parser.parse_args()
 
     geosxPath = os.path.abspath( args.geosxPath )
@@ -554,9 +616,9 @@ def main():
     if errorCollectionDir is not None:
         errorCollectionDir = os.path.abspath( errorCollectionDir )
 
-    machine = getMachine()
+    machine = getMachine( args.machine )
 
-    benchmarks = getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath )
+    benchmarks = getBenchmarksFromDirectory( os.path.abspath( args.inputDir ), machine, outputDir, geosxPath )
 
     print( "Benchmarking GEOSX found at {}".format( geosxPath ) )
     print( "Results will be written to {}".format( outputDir ) )
@@ -574,7 +636,7 @@ def main():
     if timingCollectionDir is not None:
         createDirectory( timingCollectionDir )
         for benchmark in benchmarks:
-            if benchmark.status == Status.SUCCESS:
+            if benchmark.status == Status.SUCCESS and benchmark.getTimingFile() is not None:
                 shutil.copy2( benchmark.getTimingFile(), timingCollectionDir )
 
     # Copy the output from the failed benchmarks to a new directory if asked.
@@ -0,0 +1,221 @@
+import os
+import sys
+import argparse
+import re
+
+
+# Each phase is the sum of the scopes whose name matches its regex (the scopes nested in a matching scope are not
+# counted twice). The scope names are the ones reported by the GEOSX built-in timers.
+phases = [ ( "mesh setup", r"ProblemManager::generateMesh$" ),
+           ( "assembly", r"^assembly$" ),
+           ( "linear setup", r"^linearSetup$" ),
+           ( "linear solve", r"^linearSolve$" ),
+           ( "property update", r"^propertyUpdate$" ),
+           ( "halo exchange", r"CommunicationTools::(synchronize|async|finalizeUnpack)" ),
+           ( "output", r"Output::execute$" ),
+           ( "run", r"GeosxState::run$" ) ]
+
+timersHeaderRegex = r"^Timers \(seconds, (\d+) rank\(s\)\):"
+timerRowRegex = r"^( *)(\S.*?)\s+(\d+)\s+(\S+)\s+(\S+)\s+(\S+)\s*$"
+
+
+def getTimersFromFile( filePath ):
+    """
+    Return the number of ranks and the timers reported at the end of a GEOSX standard output file.
+
+    Arguments:
+        filePath: The path of the output file to parse.
+
+    Returns:
+        A pair of the number of ranks and of a list of ( path, calls, min, avg, max ) tuples, the path of a scope
+        being the tuple of the names of its ancestors and of itself.
+    """
+    numRanks = None
+    timers = []
+    with open( filePath, "r" ) as file:
+        stack = []
+        for line in file:
+            line = line.rstrip( "\n" )
+            matches = re.search( timersHeaderRegex, line )
+            if matches is not None:
+                # Only the last report is kept.
+                numRanks = int( matches.groups()[ 0 ] )
+                timers = []
+                stack = []
+                continue
+
+            if numRanks is None or line.startswith( "Scope" ):
+                continue
+
+            matches = re.search( timerRowRegex, line )
+            if matches is None:
+                continue
+
+            indent, name, calls, minTime, avgTime, maxTime = matches.groups()
+            depth = len( indent ) // 2
+            stack = stack[ :depth ] + [ name ]
+            timers.append( ( tuple( stack ), int( calls ), float( minTime ), float( avgTime ), float( maxTime ) ) )
+
+    if numRanks is None:
+        raise Exception( "Could not find the timers in {}, GEOSX must be built without Caliper.".format( filePath ) )
+
+    return numRanks, timers
+
+
+def getPhaseTimes( timers ):
+    """
+    Return a dictionary containing the time of each phase, the maximum over the ranks being used for each scope.
+
+    Arguments:
+        timers: The list of timers returned by getTimersFromFile.
+    """
+    times = {}
+    for phase, regex in phases:
+        total = 0.0
+        found = False
+        for path, _, _, _, maxTime in timers:
+            if not re.search( regex, path[ -1 ] ):
+                continue
+            if any( re.search( regex, ancestor ) for ancestor in path[ :-1 ] ):
+                continue
+            total += maxTime
+            found = True
+
+        times[ phase ] = total if found else float( "nan" )
+
+    return times
+
+
+def getResultsFromFolder( folder ):
+    """
+    Return a list of ( xmlName, runName, ranks, phaseTimes ) for each run in the benchmark folder.
+
+    Arguments:
+        folder: The top level directory the benchmarks were run in, as created by runBenchmarks.py.
+    """
+    results = []
+    for xmlName in sorted( os.listdir( folder ) ):
+        xmlDir = os.path.join( folder, xmlName )
+        if not os.path.isdir( xmlDir ):
+            continue
+
+        for runDirName in sorted( os.listdir( xmlDir ) ):
+            outputFile = os.path.join( xmlDir, runDirName, "output.txt" )
+            if not os.path.isfile( outputFile ):
+                continue
+
+            # The run directories are named <runName>_<nodes>.
+            runName = runDirName.rsplit( "_", 1 )[ 0 ]
+            try:
+                numRanks, timers = getTimersFromFile( outputFile )
+            except Exception as e:
+                print( "Skipping {}: {}".format( outputFile, e ) )
+                continue
+
+            results.append( ( xmlName, runName, numRanks, getPhaseTimes( timers ) ) )
+
+    return results
+
+
+def getEfficiency( baseRanks, baseTime, ranks, time, weak ):
+    """
+    Return the parallel efficiency of a run relative to the base run.
+
+    Arguments:
+        baseRanks: The number of ranks of the base run.
+        baseTime: The time of the base run.
+        ranks: The number of ranks of the run.
+        time: The time of the run.
+        weak: If True the work per rank is constant (weak scaling), else the total work is (strong scaling).
+    """
+    if not time > 0.0 or not baseTime > 0.0:
+        return float( "nan" )
+    if weak:
+        return baseTime / time
+    else:
+        return ( baseTime * baseRanks ) / ( time * ranks )
+
+
+def printTable( table ):
+    """
+    Print a table in a nice format.
+
+    Arguments:
+        table: A list of rows to print. Each row should be of the same length and contain strings.
+    """
+    col_width = [ max( len( x ) for x in col ) for col in zip( *table ) ]
+    print( "| " + " | ".join( "{:{}}".format( x, col_width[ i ] ) for i, x in enumerate( table[ 0 ] ) ) + " |" )
+    print( "|" + "|".join( "-" * width + "--" for width in col_width ) + "|" )
+
+    for line in table[ 1: ]:
+        print( "| " + " | ".join( "{:>{}}".format( x, col_width[ i ] ) for i, x in enumerate( line ) ) + " |" )
+
+    print( "|" + "|".join( "-" * width + "--" for width in col_width ) + "|" )
+
+
+def generateReport( results, weak ):
+    """
+    Print the time and the efficiency of each phase for each scaling series.
+
+    In strong scaling a series is made of the runs of the same XML file with the same run name. In weak scaling
+    the problem size must grow with the number of ranks, which requires one XML file per size: a series is then
+    made of the runs with the same run name across all the XML files.
+
+    Arguments:
+        results: The list of results returned by getResultsFromFolder.
+        weak: If True generate a weak scaling report, else a strong scaling report.
+    """
+    series = {}
+    for xmlName, runName, numRanks, times in results:
+        key = runName if weak else ( xmlName, runName )
+        series.setdefault( key, [] ).append( ( numRanks, xmlName, times ) )
+
+    for key in sorted( series ):
+        runs = sorted( series[ key ], key=lambda run: run[ 0 ] )
+        baseRanks, _, baseTimes = runs[ 0 ]
+
+        print( "" )
+        print( "{} scaling of {}".format( "Weak" if weak else "Strong", key if weak else "/".join( key ) ) )
+
+        header = [ "ranks" ]
+        if weak:
+            header += [ "XML Name" ]
+        for phase, _ in phases:
+            header += [ phase, "eff." ]
+
+        lines = [ header ]
+        for numRanks, xmlName, times in runs:
+            line = [ str( numRanks ) ]
+            if weak:
+                line += [ xmlName ]
+            for phase, _ in phases:
+                efficiency = getEfficiency( baseRanks, baseTimes[ phase ], numRanks, times[ phase ], weak )
+                time = "{:.3f}".format( times[ phase ] ) if times[ phase ] == times[ phase ] else "-"
+                line += [ time, "{:.0%}".format( efficiency ) if efficiency == efficiency else "-" ]
+            lines.append( line )
+
+        printTable( lines )
+
+
+def main():
+    """ Parse the command line arguments and print the scaling reports. """
+
+    parser = argparse.ArgumentParser( description="Print the per phase scaling efficiency of benchmarks run by runBenchmarks.py." )
+    parser.add_argument( "outputDirectory", help="The directory where the benchmarks were run." )
+    parser.add_argument( "-w", "--weak", action="store_true", help="Generate a weak scaling report instead of a strong scaling one." )
+    args = parser.parse_args()
+
+    outputDir = os.path.abspath( args.outputDirectory )
+    if not os.path.isdir( outputDir ):
+        raise ValueError( "outputDirectory is not a directory!" )
+
+    results = getResultsFromFolder( outputDir )
+    if not results:
+        raise ValueError( "No timers found in {}.".format( outputDir ) )
+
+    generateReport( results, args.weak )
+    return 0
+
+
+if __name__ == "__main__" and not sys.flags.interactive:
+    sys.exit(main())
@@ -0,0 +1,4 @@
+# Same configuration as environment.cmake, with the local indices stored as 32-bit integers
+set(GEOSX_ENABLE_32BIT_LOCALINDEX ON CACHE BOOL "" FORCE)
+
+include(${CMAKE_CURRENT_LIST_DIR}/environment.cmake)
@@ -44,6 +44,8 @@ option( ENABLE_SUITESPARSE "Enables SUITESPARSE" ON )
 
 option( ENABLE_HYPRE_CUDA "Enables cuda capabilities in Hypre" OFF )
 
+option( GEOSX_ENABLE_32BIT_LOCALINDEX "Stores the local indices (connectivity maps, sparsity offsets, ...) as 32-bit integers" OFF )
+
 #if ( "${CMAKE_HOST_APPLE}" )
 #  option( ENABLE_PETSC "Enables PETSC" OFF )
 #else()
@@ -60,6 +62,20 @@ if( NOT ( GEOSX_LA_INTERFACE IN_LIST supported_LAI ) )
   message( FATAL_ERROR "GEOSX_LA_INTERFACE must be one of: ${supported_LAI}" )
 endif()
 
+### FLUID LAYOUT SETUP ###
+
+set( supported_multifluid_layouts CellOuter CellInner )
+set( GEOSX_MULTIFLUID_LAYOUT "CellOuter" CACHE STRING "Layout of the multiphase fluid arrays on host builds (CUDA builds always use CellInner)" )
+message( STATUS "GEOSX_MULTIFLUID_LAYOUT = ${GEOSX_MULTIFLUID_LAYOUT}" )
+
+if( NOT ( GEOSX_MULTIFLUID_LAYOUT IN_LIST supported_multifluid_layouts ) )
+  message( FATAL_ERROR "GEOSX_MULTIFLUID_LAYOUT must be one of: ${supported_multifluid_layouts}" )
+endif()
+
+if( GEOSX_MULTIFLUID_LAYOUT STREQUAL "CellInner" )
+  set( GEOSX_MULTIFLUID_LAYOUT_CELL_INNER ON )
+endif()
+
 ### MPI/OMP/CUDA SETUP ###
 
 option( ENABLE_MPI "" ON )
@@ -137,13 +153,20 @@ else()
     set( GEOSX_LINK_POSTPEND_FLAG "-Wl,--no-whole-archive" CACHE STRING "" )
 endif()
 
+# The index types are derived from the options above: they are forced, so that toggling an option
+# in an existing build directory is not silently ignored because of a previously cached type.
 if( ENABLE_HYPRE AND ENABLE_HYPRE_CUDA )
-    set( GEOSX_LOCALINDEX_TYPE "int" CACHE STRING "" )
-    set( GEOSX_GLOBALINDEX_TYPE "int" CACHE STRING "" )
+    set( GEOSX_LOCALINDEX_TYPE "int" CACHE STRING "" FORCE )
+    set( GEOSX_GLOBALINDEX_TYPE "int" CACHE STRING "" FORCE )
+elseif( GEOSX_ENABLE_32BIT_LOCALINDEX )
+    # Local counts (per rank) fit in 32 bits, this halves the memory and the bandwidth of all the local maps.
+    set( GEOSX_LOCALINDEX_TYPE "int" CACHE STRING "" FORCE )
+    set( GEOSX_GLOBALINDEX_TYPE "long long int" CACHE STRING "" FORCE )
 else()
-    set( GEOSX_LOCALINDEX_TYPE "std::ptrdiff_t" CACHE STRING "" )
-    set( GEOSX_GLOBALINDEX_TYPE "long long int" CACHE STRING "" )
+    set( GEOSX_LOCALINDEX_TYPE "std::ptrdiff_t" CACHE STRING "" FORCE )
+    set( GEOSX_GLOBALINDEX_TYPE "long long int" CACHE STRING "" FORCE )
 endif()
+message( STATUS "GEOSX_LOCALINDEX_TYPE = ${GEOSX_LOCALINDEX_TYPE}" )
 
 
 if( GEOSX_LOCALINDEX_TYPE STREQUAL "int" )
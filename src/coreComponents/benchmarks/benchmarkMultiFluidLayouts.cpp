@@ -0,0 +1,274 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkMultiFluidLayouts.cpp
+ * @brief Throughput of the kernels writing and reading the multiphase fluid arrays, with the layout these
+ *   arrays are compiled with (see constitutive/fluid/layouts.hpp and the CMake option GEOSX_MULTIFLUID_LAYOUT):
+ *   - the update of a Peng-Robinson fluid (MultiFluidBase kernel wrapper, writes the fluid arrays),
+ *   - the phase volume fraction kernel of the compositional solvers (reads the fluid arrays).
+ *
+ *   The arguments are the number of cells and the number of components. The layouts are compared by
+ *   building the benchmark with GEOSX_MULTIFLUID_LAYOUT=CellOuter and GEOSX_MULTIFLUID_LAYOUT=CellInner,
+ *   the layout in use being reported in the label of each benchmark.
+ */
+
+// Source includes
+#include "common/DataTypes.hpp"
+#include "constitutive/fluid/CompositionalMultiphaseFluid.hpp"
+#include "constitutive/fluid/layouts.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseKernels.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+#include <conduit.hpp>
+
+namespace geosx
+{
+namespace benchmarking
+{
+
+using namespace constitutive;
+using namespace dataRepository;
+
+/// Number of fluid phases used in all the benchmarks
+static constexpr integer NUM_PHASE = 2;
+
+/// Maximum number of components supported by the compositional kernels
+static constexpr integer MAX_NUM_COMP = 5;
+
+/**
+ * @brief Cells of a compositional problem, with the fields of the compositional solvers and a Peng-Robinson
+ *   fluid model allocated on them
+ */
+class CompositionalCells
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] numCells the number of cells
+   * @param[in] numComp the number of components, taken in the list of components below
+   */
+  CompositionalCells( localIndex const numCells,
+                      integer const numComp ):
+    m_node(),
+    m_fluidParent( "fluidParent", m_node ),
+    m_cellParent( "cellParent", m_node ),
+    m_subRegion( m_cellParent.registerGroup< CellElementSubRegion >( "cells" ) ),
+    m_fluid( m_fluidParent.registerGroup< CompositionalMultiphaseFluid >( "fluid" ) )
+  {
+    // components ordered such that the first two already give a two-phase mixture
+    string const names[MAX_NUM_COMP] = { "C1", "C10", "N2", "H2O", "CO2" };
+    real64 const molarWeight[MAX_NUM_COMP] = { 16e-3, 134e-3, 28e-3, 18e-3, 44e-3 };
+    real64 const critPres[MAX_NUM_COMP] = { 46e5, 25.3e5, 34e5, 220.5e5, 73.8e5 };
+    real64 const critTemp[MAX_NUM_COMP] = { 190.6, 622.0, 126.2, 647.0, 304.1 };
+    real64 const acFactor[MAX_NUM_COMP] = { 0.008, 0.443, 0.04, 0.344, 0.225 };
+
+    string_array & compNames = m_fluid.getReference< string_array >( MultiFluidBase::viewKeyStruct::componentNamesString() );
+    array1d< real64 > & compMolarWeight = m_fluid.getReference< array1d< real64 > >( MultiFluidBase::viewKeyStruct::componentMolarWeightString() );
+    array1d< real64 > & compCritPres = m_fluid.getReference< array1d< real64 > >( CompositionalMultiphaseFluid::viewKeyStruct::componentCriticalPressureString() );
+    array1d< real64 > & compCritTemp = m_fluid.getReference< array1d< real64 > >( CompositionalMultiphaseFluid::viewKeyStruct::componentCriticalTemperatureString() );
+    array1d< real64 > & compAcFactor = m_fluid.getReference< array1d< real64 > >( CompositionalMultiphaseFluid::viewKeyStruct::componentAcentricFactorString() );
+    compNames.resize( numComp );
+    compMolarWeight.resize( numComp );
+    compCritPres.resize( numComp );
+    compCritTemp.resize( numComp );
+    compAcFactor.resize( numComp );
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      compNames[ic] = names[ic];
+      compMolarWeight[ic] = molarWeight[ic];
+      compCritPres[ic] = critPres[ic];
+      compCritTemp[ic] = critTemp[ic];
+      compAcFactor[ic] = acFactor[ic];
+    }
+
+    string_array & phaseNames = m_fluid.getReference< string_array >( MultiFluidBase::viewKeyStruct::phaseNamesString() );
+    phaseNames.resize( NUM_PHASE );
+    phaseNames[0] = "oil"; phaseNames[1] = "gas";
+
+    string_array & eqnOfState = m_fluid.getReference< string_array >( CompositionalMultiphaseFluid::viewKeyStruct::equationsOfStateString() );
+    eqnOfState.resize( NUM_PHASE );
+    eqnOfState[0] = "PR"; eqnOfState[1] = "PR";
+
+    m_fluid.postProcessInputRecursive();
+    m_fluidParent.resize( 1 );
+    m_fluidParent.initialize();
+    m_fluidParent.initializePostInitialConditions();
+
+    // the fields of the compositional solvers used by the kernels, registered as in CompositionalMultiphaseBase
+    using namespace extrinsicMeshData::flow;
+    m_subRegion.registerExtrinsicData< pressure >( "benchmark" );
+    m_subRegion.registerExtrinsicData< temperature >( "benchmark" );
+    m_subRegion.registerExtrinsicData< globalCompDensity >( "benchmark" ).
+      reference().resizeDimension< 1 >( numComp );
+    m_subRegion.registerExtrinsicData< deltaGlobalCompDensity >( "benchmark" ).
+      reference().resizeDimension< 1 >( numComp );
+    m_subRegion.registerExtrinsicData< globalCompFraction >( "benchmark" ).
+      reference().resizeDimension< 1 >( numComp );
+    m_subRegion.registerExtrinsicData< dGlobalCompFraction_dGlobalCompDensity >( "benchmark" ).
+      reference().resizeDimension< 1, 2 >( numComp, numComp );
+    m_subRegion.registerExtrinsicData< phaseVolumeFraction >( "benchmark" ).
+      reference().resizeDimension< 1 >( NUM_PHASE );
+    m_subRegion.registerExtrinsicData< dPhaseVolumeFraction_dPressure >( "benchmark" ).
+      reference().resizeDimension< 1 >( NUM_PHASE );
+    m_subRegion.registerExtrinsicData< dPhaseVolumeFraction_dGlobalCompDensity >( "benchmark" ).
+      reference().resizeDimension< 1, 2 >( NUM_PHASE, numComp );
+    m_subRegion.resize( numCells );
+    m_fluid.allocateConstitutiveData( m_subRegion, 1 );
+
+    // vary the pressure so that the flash does not converge identically in all the cells
+    arrayView1d< real64 > const pres = m_subRegion.getExtrinsicData< pressure >();
+    arrayView1d< real64 > const temp = m_subRegion.getExtrinsicData< temperature >();
+    arrayView2d< real64, compflow::USD_COMP > const compDens = m_subRegion.getExtrinsicData< globalCompDensity >();
+    arrayView2d< real64, compflow::USD_COMP > const compFrac = m_subRegion.getExtrinsicData< globalCompFraction >();
+    forAll< serialPolicy >( numCells, [=] ( localIndex const k )
+    {
+      pres[k] = 5e6 + 1e3 * ( ( k * 7919 ) % 13 );
+      temp[k] = 297.15;
+      for( integer ic = 0; ic < numComp; ++ic )
+      {
+        compFrac[k][ic] = 1.0 / numComp;
+        compDens[k][ic] = 500.0 / numComp;
+      }
+    } );
+  }
+
+  /// @return the cells
+  CellElementSubRegion & subRegion() { return m_subRegion; }
+
+  /// @return the fluid model allocated on the cells
+  CompositionalMultiphaseFluid & fluid() { return m_fluid; }
+
+private:
+
+  /// Root of the data repository of the benchmark
+  conduit::Node m_node;
+
+  /// Parent of the fluid model
+  Group m_fluidParent;
+
+  /// Parent of the cells
+  Group m_cellParent;
+
+  /// Cells holding the fields and the fluid arrays
+  CellElementSubRegion & m_subRegion;
+
+  /// Fluid model
+  CompositionalMultiphaseFluid & m_fluid;
+};
+
+/**
+ * @brief Label a benchmark with the layout of the fluid arrays
+ * @param[in] state the benchmark state
+ */
+void setLayoutLabel( benchmark::State & state )
+{
+  state.SetLabel( multifluid::USD_PHASE == 0 ? "CellOuter" : "CellInner" );
+}
+
+/**
+ * @brief Time the update of the fluid model in all the cells
+ * @param[in] state the benchmark state, with the number of cells and the number of components as arguments
+ */
+void benchmarkFluidUpdate( benchmark::State & state )
+{
+  localIndex const numCells = LvArray::integerConversion< localIndex >( state.range( 0 ) );
+  integer const numComp = LvArray::integerConversion< integer >( state.range( 1 ) );
+  CompositionalCells cells( numCells, numComp );
+
+  CellElementSubRegion & subRegion = cells.subRegion();
+  arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  arrayView1d< real64 const > const temp = subRegion.getExtrinsicData< extrinsicMeshData::flow::temperature >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
+    subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompFraction >();
+  CompositionalMultiphaseFluid::KernelWrapper const fluidWrapper = cells.fluid().createKernelWrapper();
+
+  for( auto _ : state )
+  {
+    compositionalMultiphaseBaseKernels::FluidUpdateKernel::
+      launch< CompositionalMultiphaseFluid::exec_policy >( numCells, fluidWrapper, pres, temp, compFrac );
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed( state.iterations() * numCells );
+  setLayoutLabel( state );
+}
+
+/**
+ * @brief Time the computation of the phase volume fractions from the fluid properties in all the cells
+ * @param[in] state the benchmark state, with the number of cells and the number of components as arguments
+ */
+void benchmarkPhaseVolumeFraction( benchmark::State & state )
+{
+  localIndex const numCells = LvArray::integerConversion< localIndex >( state.range( 0 ) );
+  integer const numComp = LvArray::integerConversion< integer >( state.range( 1 ) );
+  CompositionalCells cells( numCells, numComp );
+
+  // evaluate the fluid once, so that the kernel reads actual phase properties
+  CellElementSubRegion & subRegion = cells.subRegion();
+  compositionalMultiphaseBaseKernels::FluidUpdateKernel::
+    launch< CompositionalMultiphaseFluid::exec_policy >( numCells,
+                                                         cells.fluid().createKernelWrapper(),
+                                                         subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >().toViewConst(),
+                                                         subRegion.getExtrinsicData< extrinsicMeshData::flow::temperature >().toViewConst(),
+                                                         subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompFraction >().toViewConst() );
+
+  for( auto _ : state )
+  {
+    compositionalMultiphaseBaseKernels::PhaseVolumeFractionKernelFactory::
+      createAndLaunch< parallelDevicePolicy<> >( numComp, NUM_PHASE, subRegion, cells.fluid() );
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed( state.iterations() * numCells );
+  setLayoutLabel( state );
+}
+
+/**
+ * @brief Register the problem sizes, from cache-resident to memory-bound, and the numbers of components
+ * @param[in] bench the benchmark
+ */
+void setProblemSizes( benchmark::internal::Benchmark * const bench )
+{
+  bench->ArgNames( { "cells", "components" } );
+  for( int64_t const numCells : { 1 << 10, 1 << 13, 1 << 16 } )
+  {
+    for( int64_t const numComp : { 2, 4, MAX_NUM_COMP } )
+    {
+      bench->Args( { numCells, numComp } );
+    }
+  }
+  bench->Unit( benchmark::kMicrosecond );
+}
+
+BENCHMARK( benchmarkFluidUpdate )->Apply( setProblemSizes );
+BENCHMARK( benchmarkPhaseVolumeFraction )->Apply( setProblemSizes );
+
+} // namespace benchmarking
+} // namespace geosx
+
+int main( int argc, char * * argv )
+{
+  ::benchmark::Initialize( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  ::benchmark::RunSpecifiedBenchmarks();
+  geosx::basicCleanup();
+  return 0;
+}
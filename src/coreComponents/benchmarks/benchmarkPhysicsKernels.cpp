@@ -0,0 +1,528 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkPhysicsKernels.cpp
+ * @brief Throughput of the assembly and update kernels of the physics solvers on structured meshes built
+ *   in-process (InternalMesh), for several mesh sizes and numbers of threads:
+ *   - SinglePhaseFVM: ElementBasedAssemblyKernel (accumulation) and FaceBasedAssemblyKernel (TPFA fluxes),
+ *   - CompositionalMultiphaseFVM: the same kernels with a 4-component Peng-Robinson fluid,
+ *   - SolidMechanics_LagrangianFEM: the quasi-static small strain kernel,
+ *   - AcousticSEM: the explicit time step,
+ *   - the update kernels (createKernelWrapper().update) of the compositional (Peng-Robinson), dead-oil,
+ *     black-oil and CO2-brine fluid models.
+ *
+ *   The items processed are the cells. The bytes processed are the bytes of the assembled Jacobian and
+ *   right-hand side (or of the nodal fields and cell-to-node map of the explicit step), i.e. a lower bound
+ *   of the memory traffic of the kernels; they are not reported for the fluid updates, which are compute-bound.
+ */
+
+// Source includes
+#include "common/DataTypes.hpp"
+#include "common/TimerRegistry.hpp"
+#include "codingUtilities/StringUtilities.hpp"
+#include "constitutive/fluid/MultiFluidBase.hpp"
+#include "constitutive/fluid/multiFluidSelector.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+// System includes
+#include <cstdio>
+#include <fstream>
+
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
+namespace geosx
+{
+namespace benchmarking
+{
+
+/// Command line options forwarded to the GeosxState of each benchmark
+CommandLineOptions g_commandLineOptions;
+
+/// Size of the cubic domain (m)
+static constexpr real64 DOMAIN_SIZE = 1000.0;
+
+/**
+ * @brief Build the mesh section of the input, a cube of numCellsPerDim^3 hexahedra
+ * @param[in] numCellsPerDim the number of cells in each direction
+ * @return the XML of the mesh
+ */
+string meshInput( localIndex const numCellsPerDim )
+{
+  return GEOSX_FMT( "  <Mesh>\n"
+                    "    <InternalMesh name=\"mesh\" elementTypes=\"{{ C3D8 }}\"\n"
+                    "                  xCoords=\"{{ 0, {1} }}\" yCoords=\"{{ 0, {1} }}\" zCoords=\"{{ 0, {1} }}\"\n"
+                    "                  nx=\"{{ {0} }}\" ny=\"{{ {0} }}\" nz=\"{{ {0} }}\"\n"
+                    "                  cellBlockNames=\"{{ cb }}\"/>\n"
+                    "  </Mesh>\n",
+                    numCellsPerDim, DOMAIN_SIZE );
+}
+
+string singlePhaseInput( localIndex const numCellsPerDim )
+{
+  return "<Problem>\n"
+         "  <Solvers>\n"
+         "    <SinglePhaseFVM name=\"solver\" discretization=\"tpfa\" targetRegions=\"{ region }\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( numCellsPerDim ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteVolume>\n"
+         "      <TwoPointFluxApproximation name=\"tpfa\"/>\n"
+         "    </FiniteVolume>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb }\" materialList=\"{ water, rock }\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <CompressibleSinglePhaseFluid name=\"water\" defaultDensity=\"1000\" defaultViscosity=\"0.001\"\n"
+         "                                  referencePressure=\"0.0\" compressibility=\"5e-10\" viscosibility=\"0.0\"/>\n"
+         "    <CompressibleSolidConstantPermeability name=\"rock\" solidModelName=\"nullSolid\"\n"
+         "                                           porosityModelName=\"rockPorosity\" permeabilityModelName=\"rockPerm\"/>\n"
+         "    <NullModel name=\"nullSolid\"/>\n"
+         "    <PressurePorosity name=\"rockPorosity\" defaultReferencePorosity=\"0.05\" referencePressure=\"0.0\" compressibility=\"1.0e-9\"/>\n"
+         "    <ConstantPermeability name=\"rockPerm\" permeabilityComponents=\"{ 1.0e-12, 1.0e-12, 1.0e-15 }\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         "    <FieldSpecification name=\"initialPressure\" initialCondition=\"1\" setNames=\"{ all }\"\n"
+         "                        objectPath=\"ElementRegions/region/elementSubRegions/cb\" fieldName=\"pressure\" scale=\"5e6\"/>\n"
+         "  </FieldSpecifications>\n"
+         "</Problem>\n";
+}
+
+/**
+ * @brief Build the input of a compositional multiphase flow problem
+ * @param[in] numCellsPerDim the number of cells in each direction
+ * @param[in] temperature the temperature of the problem (K)
+ * @param[in] fluidInput the XML of the fluid model, named "fluid"
+ * @param[in] phaseNames the names of the phases of the fluid
+ * @param[in] composition the initial global component fractions
+ * @return the XML of the problem
+ */
+string multiphaseInput( localIndex const numCellsPerDim,
+                        real64 const temperature,
+                        string const & fluidInput,
+                        std::vector< string > const & phaseNames,
+                        std::vector< real64 > const & composition )
+{
+  std::vector< real64 > const zeros( phaseNames.size(), 0.0 );
+  std::vector< real64 > const exponents( phaseNames.size(), 2.0 );
+  std::vector< real64 > const maxValues( phaseNames.size(), 1.0 );
+
+  string input = "<Problem>\n"
+                 "  <Solvers>\n"
+                 "    <CompositionalMultiphaseFVM name=\"solver\" discretization=\"tpfa\" targetRegions=\"{ region }\"\n"
+                 "                                temperature=\"" + GEOSX_FMT( "{}", temperature ) + "\" useMass=\"1\"/>\n"
+                 "  </Solvers>\n"
+                 + meshInput( numCellsPerDim ) +
+                 "  <NumericalMethods>\n"
+                 "    <FiniteVolume>\n"
+                 "      <TwoPointFluxApproximation name=\"tpfa\"/>\n"
+                 "    </FiniteVolume>\n"
+                 "  </NumericalMethods>\n"
+                 "  <ElementRegions>\n"
+                 "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb }\" materialList=\"{ fluid, rock, relperm }\"/>\n"
+                 "  </ElementRegions>\n"
+                 "  <Constitutive>\n"
+                 + fluidInput +
+                 "    <CompressibleSolidConstantPermeability name=\"rock\" solidModelName=\"nullSolid\"\n"
+                 "                                           porosityModelName=\"rockPorosity\" permeabilityModelName=\"rockPerm\"/>\n"
+                 "    <NullModel name=\"nullSolid\"/>\n"
+                 "    <PressurePorosity name=\"rockPorosity\" defaultReferencePorosity=\"0.05\" referencePressure=\"0.0\" compressibility=\"1.0e-9\"/>\n";
+  input += GEOSX_FMT( "    <BrooksCoreyRelativePermeability name=\"relperm\" phaseNames=\"{{ {} }}\" phaseMinVolumeFraction=\"{{ {} }}\"\n"
+                      "                                     phaseRelPermExponent=\"{{ {} }}\" phaseRelPermMaxValue=\"{{ {} }}\"/>\n",
+                      stringutilities::join( phaseNames, ", " ),
+                      stringutilities::join( zeros, ", " ),
+                      stringutilities::join( exponents, ", " ),
+                      stringutilities::join( maxValues, ", " ) );
+  input += "    <ConstantPermeability name=\"rockPerm\" permeabilityComponents=\"{ 2.0e-16, 2.0e-16, 2.0e-16 }\"/>\n"
+           "  </Constitutive>\n"
+           "  <FieldSpecifications>\n"
+           "    <FieldSpecification name=\"initialPressure\" initialCondition=\"1\" setNames=\"{ all }\"\n"
+           "                        objectPath=\"ElementRegions/region/elementSubRegions/cb\" fieldName=\"pressure\" scale=\"5e6\"/>\n";
+  for( std::size_t ic = 0; ic < composition.size(); ++ic )
+  {
+    input += GEOSX_FMT( "    <FieldSpecification name=\"initialComposition{0}\" initialCondition=\"1\" setNames=\"{{ all }}\"\n"
+                        "                        objectPath=\"ElementRegions/region/elementSubRegions/cb\" fieldName=\"globalCompFraction\"\n"
+                        "                        component=\"{0}\" scale=\"{1}\"/>\n",
+                        ic, composition[ic] );
+  }
+  input += "  </FieldSpecifications>\n"
+           "</Problem>\n";
+  return input;
+}
+
+string compositionalInput( localIndex const numCellsPerDim )
+{
+  return multiphaseInput( numCellsPerDim, 297.15,
+                          "    <CompositionalMultiphaseFluid name=\"fluid\" phaseNames=\"{ oil, gas }\" equationsOfState=\"{ PR, PR }\"\n"
+                          "                                  componentNames=\"{ N2, C10, C20, H2O }\"\n"
+                          "                                  componentCriticalPressure=\"{ 34e5, 25.3e5, 14.6e5, 220.5e5 }\"\n"
+                          "                                  componentCriticalTemperature=\"{ 126.2, 622.0, 782.0, 647.0 }\"\n"
+                          "                                  componentAcentricFactor=\"{ 0.04, 0.443, 0.816, 0.344 }\"\n"
+                          "                                  componentMolarWeight=\"{ 28e-3, 134e-3, 275e-3, 18e-3 }\"\n"
+                          "                                  componentVolumeShift=\"{ 0, 0, 0, 0 }\"\n"
+                          "                                  componentBinaryCoeff=\"{ { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } }\"/>\n",
+                          { "oil", "gas" },
+                          { 0.099, 0.3, 0.6, 0.001 } );
+}
+
+string deadOilInput( localIndex const numCellsPerDim )
+{
+  return multiphaseInput( numCellsPerDim, 297.15,
+                          "    <DeadOilFluid name=\"fluid\" phaseNames=\"{ oil, gas, water }\"\n"
+                          "                  surfaceDensities=\"{ 800.0, 0.9907, 1022.0 }\" componentMolarWeight=\"{ 114e-3, 16e-3, 18e-3 }\"\n"
+                          "                  tableFiles=\"{ pvdo.txt, pvdg.txt, pvtw.txt }\"/>\n",
+                          { "oil", "gas", "water" },
+                          { 0.6, 0.1, 0.3 } );
+}
+
+string blackOilInput( localIndex const numCellsPerDim )
+{
+  return multiphaseInput( numCellsPerDim, 297.15,
+                          "    <BlackOilFluid name=\"fluid\" phaseNames=\"{ oil, gas, water }\"\n"
+                          "                   surfaceDensities=\"{ 800.0, 0.9907, 1022.0 }\" componentMolarWeight=\"{ 114e-3, 16e-3, 18e-3 }\"\n"
+                          "                   tableFiles=\"{ pvto.txt, pvdg.txt, pvtw.txt }\"/>\n",
+                          { "oil", "gas", "water" },
+                          { 0.6, 0.1, 0.3 } );
+}
+
+string co2BrineInput( localIndex const numCellsPerDim )
+{
+  return multiphaseInput( numCellsPerDim, 368.15,
+                          "    <CO2BrinePhillipsFluid name=\"fluid\" phaseNames=\"{ gas, water }\" componentNames=\"{ co2, water }\"\n"
+                          "                           componentMolarWeight=\"{ 44e-3, 18e-3 }\"\n"
+                          "                           phasePVTParaFiles=\"{ pvtgas.txt, pvtliquid.txt }\" flashModelParaFile=\"co2flash.txt\"/>\n",
+                          { "gas", "water" },
+                          { 0.3, 0.7 } );
+}
+
+/// Tables of the black-oil, dead-oil and CO2-brine fluids, written in the working directory while the benchmarks run
+std::vector< std::pair< string, string > > const g_fluidTables =
+{
+  { "pvdo.txt", "# P[Pa] Bo[m3/sm3] Visc(Pa.s)\n"
+                "2000000 1.02 0.000975\n"
+                "5000000 1.03 0.00091\n"
+                "10000000 1.04 0.00083\n"
+                "20000000 1.05 0.000695\n"
+                "30000000 1.07 0.000594\n"
+                "40000000 1.08 0.00051\n"
+                "50000000.7 1.09 0.000449\n" },
+  { "pvdg.txt", "# Pg(Pa) Bg(m3/sm3) Visc(Pa.s)\n"
+                "3000000 0.04234 0.00001344\n"
+                "6000000 0.02046 0.0000142\n"
+                "9000000 0.01328 0.00001526\n"
+                "12000000 0.00977 0.0000166\n"
+                "15000000 0.00773 0.00001818\n"
+                "18000000 0.006426 0.00001994\n"
+                "21000000 0.005541 0.00002181\n"
+                "24000000 0.004919 0.0000237\n"
+                "27000000 0.004471 0.00002559\n"
+                "29500000 0.004194 0.00002714\n"
+                "31000000 0.004031 0.00002806\n"
+                "33000000 0.00391 0.00002832\n"
+                "53000000 0.003868 0.00002935\n" },
+  { "pvtw.txt", "# Pref[Pa] Bw[m3/sm3] Cp[1/Pa] Visc[Pa.s]\n"
+                "30600000.1 1.03 0.00000000041 0.0003\n" },
+  { "pvto.txt", "# Rs[sm3/sm3] Pbub[Pa] Bo[m3/sm3] Visc(Pa.s)\n"
+                "2 2000000 1.02 0.000975\n"
+                "5 5000000 1.03 0.00091\n"
+                "10 10000000 1.04 0.00083\n"
+                "15 20000000 1.05 0.000695\n"
+                "   90000000 1.03 0.000985\n"
+                "30 30000000 1.07 0.000594\n"
+                "40 40000000 1.08 0.00051\n"
+                "   50000000 1.07 0.000549\n"
+                "   90000000 1.06 0.00074\n"
+                "50 50000000.7 1.09 0.000449\n"
+                "   90000000.7 1.08 0.000605\n" },
+  { "pvtgas.txt", "DensityFun SpanWagnerCO2Density 1e6 1.5e7 5e4 367.15 369.15 1\n"
+                  "ViscosityFun FenghourCO2Viscosity 1e6 1.5e7 5e4 367.15 369.15 1\n" },
+  { "pvtliquid.txt", "DensityFun PhillipsBrineDensity 1e6 1.5e7 5e4 367.15 369.15 1 0.2\n"
+                     "ViscosityFun PhillipsBrineViscosity 0.1\n" },
+  { "co2flash.txt", "FlashModel CO2Solubility 1e6 1.5e7 5e4 367.15 369.15 1 0.15\n" }
+};
+
+string solidMechanicsInput( localIndex const numCellsPerDim )
+{
+  return "<Problem>\n"
+         "  <Solvers>\n"
+         "    <SolidMechanics_LagrangianFEM name=\"solver\" timeIntegrationOption=\"QuasiStatic\"\n"
+         "                                  discretization=\"FE1\" targetRegions=\"{ region }\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( numCellsPerDim ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteElements>\n"
+         "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+         "    </FiniteElements>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb }\" materialList=\"{ shale }\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <ElasticIsotropic name=\"shale\" defaultDensity=\"2700\" defaultBulkModulus=\"5.5556e9\" defaultShearModulus=\"4.16667e9\"/>\n"
+         "  </Constitutive>\n"
+         "</Problem>\n";
+}
+
+string acousticInput( localIndex const numCellsPerDim )
+{
+  return "<Problem>\n"
+         "  <Solvers>\n"
+         "    <AcousticSEM name=\"solver\" discretization=\"FE1\" targetRegions=\"{ region }\"\n"
+         "                 sourceCoordinates=\"{ { 500, 500, 500 } }\" timeSourceFrequency=\"5.0\"\n"
+         "                 receiverCoordinates=\"{ { 250, 250, 250 } }\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( numCellsPerDim ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteElements>\n"
+         "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+         "    </FiniteElements>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb }\" materialList=\"{ nullModel }\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <NullModel name=\"nullModel\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         "    <FieldSpecification name=\"cellVelocity\" initialCondition=\"1\" setNames=\"{ all }\"\n"
+         "                        objectPath=\"ElementRegions/region/elementSubRegions/cb\" fieldName=\"mediumVelocity\" scale=\"1500\"/>\n"
+         "  </FieldSpecifications>\n"
+         "</Problem>\n";
+}
+
+/**
+ * @brief Set the number of threads used by the host kernels
+ * @param[in] numThreads the number of threads
+ */
+void setNumThreads( integer const numThreads )
+{
+#if defined( GEOSX_USE_OPENMP )
+  omp_set_num_threads( numThreads );
+#else
+  GEOSX_UNUSED_VAR( numThreads );
+#endif
+}
+
+/**
+ * @brief Set up a problem from its input and return its solver
+ * @param[in] state the state holding the problem
+ * @param[in] input the XML input of the problem, with a solver named "solver"
+ * @return the solver
+ */
+SolverBase & setupProblem( GeosxState & state, string const & input )
+{
+  ProblemManager & problemManager = state.getProblemManager();
+  problemManager.parseInputString( input );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+  return problemManager.getPhysicsSolverManager().getGroup< SolverBase >( "solver" );
+}
+
+/**
+ * @brief Time the assembly of the Jacobian and residual of an implicit solver
+ * @param[in] state the benchmark state, with the number of cells per direction and the number of threads as arguments
+ * @param[in] makeInput the function building the XML input for a given number of cells per direction
+ */
+template< typename MAKE_INPUT >
+void benchmarkAssembly( benchmark::State & state, MAKE_INPUT && makeInput )
+{
+  localIndex const numCellsPerDim = LvArray::integerConversion< localIndex >( state.range( 0 ) );
+  setNumThreads( LvArray::integerConversion< integer >( state.range( 1 ) ) );
+
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  SolverBase & solver = setupProblem( geosxState, makeInput( numCellsPerDim ) );
+  DomainPartition & domain = geosxState.getProblemManager().getDomainPartition();
+
+  real64 const time = 0.0;
+  real64 const dt = 1.0;
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( time, dt, domain );
+
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  ParallelVector & rhs = solver.getSystemRhs();
+
+  for( auto _ : state )
+  {
+    localMatrix.zero();
+    rhs.zero();
+    arrayView1d< real64 > const localRhs = rhs.open();
+    solver.assembleSystem( time, dt, domain, solver.getDofManager(), localMatrix.toViewConstSizes(), localRhs );
+    rhs.close();
+    benchmark::ClobberMemory();
+  }
+
+  int64_t const numCells = numCellsPerDim * numCellsPerDim * numCellsPerDim;
+  int64_t const numBytes = localMatrix.numNonZeros() * static_cast< int64_t >( sizeof( real64 ) + sizeof( globalIndex ) )
+                           + rhs.localSize() * static_cast< int64_t >( sizeof( real64 ) );
+  state.SetItemsProcessed( state.iterations() * numCells );
+  state.SetBytesProcessed( state.iterations() * numBytes );
+
+  // the timers recorded by the setup and the iterations are not reported, discard them
+  TimerRegistry::clear();
+}
+
+/**
+ * @brief Time the explicit step of the acoustic SEM solver
+ * @param[in] state the benchmark state, with the number of cells per direction and the number of threads as arguments
+ */
+void benchmarkAcousticStep( benchmark::State & state )
+{
+  localIndex const numCellsPerDim = LvArray::integerConversion< localIndex >( state.range( 0 ) );
+  setNumThreads( LvArray::integerConversion< integer >( state.range( 1 ) ) );
+
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  SolverBase & solver = setupProblem( geosxState, acousticInput( numCellsPerDim ) );
+  DomainPartition & domain = geosxState.getProblemManager().getDomainPartition();
+
+  // stable time step: a fraction of the time needed by the wave to cross a cell
+  real64 const dt = 0.1 * DOMAIN_SIZE / numCellsPerDim / 1500.0;
+  integer cycle = 0;
+
+  for( auto _ : state )
+  {
+    solver.explicitStep( cycle * dt, dt, cycle, domain );
+    ++cycle;
+    benchmark::ClobberMemory();
+  }
+
+  int64_t const numCells = numCellsPerDim * numCellsPerDim * numCellsPerDim;
+  int64_t const numNodes = ( numCellsPerDim + 1 ) * ( numCellsPerDim + 1 ) * ( numCellsPerDim + 1 );
+  // pressure at steps n-1, n, n+1, mass and damping matrices, and the cell-to-node map
+  int64_t const numBytes = 5 * numNodes * static_cast< int64_t >( sizeof( real64 ) )
+                           + 8 * numCells * static_cast< int64_t >( sizeof( localIndex ) );
+  state.SetItemsProcessed( state.iterations() * numCells );
+  state.SetBytesProcessed( state.iterations() * numBytes );
+
+  TimerRegistry::clear();
+}
+
+/**
+ * @brief Time the update of the multiphase fluid model in all the cells, as done at each nonlinear iteration
+ * @param[in] state the benchmark state, with the number of cells per direction and the number of threads as arguments
+ * @param[in] makeInput the function building the XML input for a given number of cells per direction
+ */
+template< typename MAKE_INPUT >
+void benchmarkFluidUpdate( benchmark::State & state, MAKE_INPUT && makeInput )
+{
+  localIndex const numCellsPerDim = LvArray::integerConversion< localIndex >( state.range( 0 ) );
+  setNumThreads( LvArray::integerConversion< integer >( state.range( 1 ) ) );
+
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblem( geosxState, makeInput( numCellsPerDim ) );
+  DomainPartition & domain = geosxState.getProblemManager().getDomainPartition();
+
+  CellElementSubRegion & subRegion = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().
+                                       getRegion( "region" ).getSubRegion< CellElementSubRegion >( "cb" );
+  arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  arrayView1d< real64 const > const temp = subRegion.getExtrinsicData< extrinsicMeshData::flow::temperature >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
+    subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompFraction >();
+  constitutive::MultiFluidBase & fluid = subRegion.getConstitutiveModel< constitutive::MultiFluidBase >( "fluid" );
+
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+    using ExecPolicy = typename FluidType::exec_policy;
+    typename FluidType::KernelWrapper const fluidWrapper = castedFluid.createKernelWrapper();
+
+    for( auto _ : state )
+    {
+      forAll< ExecPolicy >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+      {
+        for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+        {
+          fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+        }
+      } );
+      benchmark::ClobberMemory();
+    }
+  } );
+
+  state.SetItemsProcessed( state.iterations() * subRegion.size() );
+
+  TimerRegistry::clear();
+}
+
+/**
+ * @brief Register the mesh sizes, from cache-resident to memory-bound, and the numbers of threads
+ * @param[in] bench the benchmark
+ */
+void setProblemSizes( benchmark::internal::Benchmark * const bench )
+{
+  std::vector< int64_t > numThreads{ 1 };
+#if defined( GEOSX_USE_OPENMP )
+  for( int64_t n = 2; n <= omp_get_max_threads(); n *= 2 )
+  {
+    numThreads.emplace_back( n );
+  }
+#endif
+
+  for( int64_t const numCellsPerDim : { 16, 32, 64 } )
+  {
+    for( int64_t const n : numThreads )
+    {
+      bench->Args( { numCellsPerDim, n } );
+    }
+  }
+  bench->Unit( benchmark::kMillisecond );
+}
+
+BENCHMARK_CAPTURE( benchmarkAssembly, SinglePhaseFVM, singlePhaseInput )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkAssembly, CompositionalMultiphaseFVM, compositionalInput )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkAssembly, SolidMechanicsSmallStrainQuasiStatic, solidMechanicsInput )->Apply( setProblemSizes );
+BENCHMARK( benchmarkAcousticStep )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkFluidUpdate, CompositionalMultiphaseFluid, compositionalInput )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkFluidUpdate, DeadOilFluid, deadOilInput )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkFluidUpdate, BlackOilFluid, blackOilInput )->Apply( setProblemSizes );
+BENCHMARK_CAPTURE( benchmarkFluidUpdate, CO2BrinePhillipsFluid, co2BrineInput )->Apply( setProblemSizes );
+
+} // namespace benchmarking
+} // namespace geosx
+
+int main( int argc, char * * argv )
+{
+  ::benchmark::Initialize( &argc, argv );
+  geosx::benchmarking::g_commandLineOptions = *geosx::basicSetup( argc, argv );
+
+  for( auto const & fileAndContent : geosx::benchmarking::g_fluidTables )
+  {
+    std::ofstream( fileAndContent.first ) << fileAndContent.second;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  for( auto const & fileAndContent : geosx::benchmarking::g_fluidTables )
+  {
+    std::remove( fileAndContent.first.c_str() );
+  }
+
+  geosx::basicCleanup();
+  return 0;
+}
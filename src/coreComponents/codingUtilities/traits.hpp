@@ -88,6 +88,13 @@ HAS_MEMBER_FUNCTION( size, localIndex, );
  */
 HAS_MEMBER_FUNCTION( capacity, localIndex, );
 
+/**
+ * @brief Defines a static constexpr bool HasMemberFunction_valueCapacity< @p CLASS >
+ *        that is true iff the method @p CLASS ::valueCapacity() exists and the return value is convertable to a localIndex.
+ * @tparam CLASS The type to test.
+ */
+HAS_MEMBER_FUNCTION( valueCapacity, localIndex, );
+
 /**
  * @brief Defines a static constexpr bool HasMemberFunction_resize< @p CLASS >
  *        that is True iff the method @p CLASS ::resize( int ) exists.
@@ -1,6 +1,8 @@
 #include "BufferAllocator.hpp"
 #include "DataTypes.hpp"
 
+#include <atomic>
+
 #ifdef GEOSX_USE_CHAI
 namespace geosx
 {
@@ -17,6 +19,26 @@ bool getPreferPinned( )
   return prefer_pinned_buffer;
 }
 
+namespace
+{
+// updated atomically since the buffers may be allocated from several threads
+std::atomic< std::ptrdiff_t > buffer_bytes( 0 );
+std::atomic< std::ptrdiff_t > buffer_high_watermark( 0 );
+}
+
+void recordBufferAllocation( std::ptrdiff_t bytes )
+{
+  std::ptrdiff_t const current = buffer_bytes.fetch_add( bytes ) + bytes;
+  std::ptrdiff_t peak = buffer_high_watermark.load();
+  while( current > peak && !buffer_high_watermark.compare_exchange_weak( peak, current ) )
+  {}
+}
+
+std::size_t getBufferHighWatermark( )
+{
+  return static_cast< std::size_t >( buffer_high_watermark.load() );
+}
+
 }
 
 #endif
@@ -25,6 +25,8 @@
 #include <umpire/ResourceManager.hpp>
 #include <umpire/TypedAllocator.hpp>
 
+#include <cstddef>
+
 namespace geosx
 {
 /**
@@ -41,6 +43,20 @@ void setPreferPinned( bool p );
  */
 bool getPreferPinned( );
 
+/**
+ * @brief Record an allocation or a deallocation made by a BufferAllocator.
+ * @param bytes The number of bytes allocated (positive) or deallocated (negative).
+ */
+void recordBufferAllocation( std::ptrdiff_t bytes );
+
+/**
+ * @brief Get the high water mark of the BufferAllocators.
+ * @return The largest number of bytes simultaneously allocated by the BufferAllocators of this rank.
+ * @note The buffers are allocated from the Host or Pinned umpire allocators, whose high water marks
+ *       also include the other allocations made from them.
+ */
+std::size_t getBufferHighWatermark( );
+
 /**
  * @brief Wrapper class for umpire allocator, only used to determine which umpire allocator to use based on
  * availability.
@@ -91,6 +107,7 @@ public:
    */
   value_type * allocate( size_t sz )
   {
+    recordBufferAllocation( static_cast< std::ptrdiff_t >( sz * sizeof( value_type ) ) );
     return m_alloc.allocate( sz );
   }
 
@@ -102,7 +119,10 @@ public:
   void deallocate( value_type * buffer, size_t sz )
   {
     if( buffer != nullptr )
+    {
+      recordBufferAllocation( -static_cast< std::ptrdiff_t >( sz * sizeof( value_type ) ) );
       m_alloc.deallocate( buffer, sz );
+    }
   }
 
   /**
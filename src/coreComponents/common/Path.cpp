@@ -14,11 +14,14 @@
 
 #include "Path.hpp"
 #include "Logger.hpp"
+#include "MpiWrapper.hpp"
 
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
+#include <fstream>
+#include <sstream>
 #include <vector>
 
 namespace geosx
@@ -115,4 +118,28 @@ void makeDirsForPath( std::string const & path )
   while( pos != std::string::npos );
 }
 
+bool readFileCollectively( std::string const & path, std::string & contents )
+{
+  contents.clear();
+  int fileRead = 0;
+  if( MpiWrapper::commRank( MPI_COMM_GEOSX ) == 0 )
+  {
+    std::ifstream fileStream( path.c_str() );
+    if( fileStream )
+    {
+      std::ostringstream contentsStream;
+      contentsStream << fileStream.rdbuf();
+      contents = contentsStream.str();
+      fileRead = 1;
+    }
+  }
+
+  MpiWrapper::broadcast( fileRead, 0, MPI_COMM_GEOSX );
+  if( fileRead )
+  {
+    MpiWrapper::broadcast( contents, 0, MPI_COMM_GEOSX );
+  }
+  return fileRead == 1;
+}
+
 } /* end namespace geosx */
@@ -166,6 +166,17 @@ void makeDirectory( std::string const & path );
  */
 void makeDirsForPath( std::string const & path );
 
+/*!
+ * @brief Read the whole contents of a file on rank 0 and broadcast them to all the ranks.
+ * @param[in] path the path to the file
+ * @param[out] contents the contents of the file (empty if it could not be read)
+ * @return true if the file could be read
+ *
+ * This is a collective call over MPI_COMM_GEOSX: it avoids having all the ranks
+ * open the same input file at once on the shared file system.
+ */
+bool readFileCollectively( std::string const & path, std::string & contents );
+
 } /* end namespace geosx */
 
 
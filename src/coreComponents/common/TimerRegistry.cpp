@@ -0,0 +1,227 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TimerRegistry.cpp
+ */
+
+#include "TimerRegistry.hpp"
+
+#include "common/DataTypes.hpp"
+#include "common/Format.hpp"
+#include "common/Logger.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// Timed scope, child of the scope that was active when it was first entered
+struct TimerNode
+{
+  TimerNode( char const * nodeName, TimerNode * const parentNode ):
+    name( nodeName ),
+    parent( parentNode )
+  {}
+
+  /// Name of the scope
+  string name;
+
+  /// Parent scope (nullptr for the root)
+  TimerNode * parent;
+
+  /// Child scopes, in the order in which they were first entered
+  std::vector< std::unique_ptr< TimerNode > > children;
+
+  /// Time point at which the scope was last entered
+  std::chrono::steady_clock::time_point start;
+
+  /// Accumulated time spent in the scope (seconds)
+  real64 time = 0.0;
+
+  /// Number of times the scope was exited
+  long long count = 0;
+};
+
+/// Thread running the static initialization, i.e. the main thread: the only one recording its scopes
+std::thread::id const mainThreadId = std::this_thread::get_id();
+
+TimerNode & rootNode()
+{
+  static TimerNode root( "", nullptr );
+  return root;
+}
+
+/// Currently active scope of the main thread
+TimerNode * currentNode = &rootNode();
+
+bool isMainThread()
+{
+  return std::this_thread::get_id() == mainThreadId;
+}
+
+/**
+ * @brief List the scopes of a subtree in depth-first order.
+ * @param[in] node the root of the subtree (not listed itself)
+ * @param[in] path the path of @p node
+ * @param[in] depth the depth of the children of @p node
+ * @param[inout] nodes the listed scopes
+ * @param[inout] paths the paths of the listed scopes (names of the ancestors and of the scope joined by '/')
+ * @param[inout] depths the depths of the listed scopes
+ */
+void flattenTree( TimerNode const & node,
+                  string const & path,
+                  integer const depth,
+                  std::vector< TimerNode const * > & nodes,
+                  std::vector< string > & paths,
+                  std::vector< integer > & depths )
+{
+  for( std::unique_ptr< TimerNode > const & child : node.children )
+  {
+    string const childPath = path + '/' + child->name;
+    nodes.emplace_back( child.get() );
+    paths.emplace_back( childPath );
+    depths.emplace_back( depth );
+    flattenTree( *child, childPath, depth + 1, nodes, paths, depths );
+  }
+}
+
+}
+
+void TimerRegistry::begin( char const * const name )
+{
+  if( !isMainThread() )
+  {
+    return;
+  }
+
+  TimerNode * child = nullptr;
+  for( std::unique_ptr< TimerNode > const & candidate : currentNode->children )
+  {
+    if( std::strcmp( candidate->name.c_str(), name ) == 0 )
+    {
+      child = candidate.get();
+      break;
+    }
+  }
+  if( child == nullptr )
+  {
+    currentNode->children.emplace_back( std::make_unique< TimerNode >( name, currentNode ) );
+    child = currentNode->children.back().get();
+  }
+
+  currentNode = child;
+  currentNode->start = std::chrono::steady_clock::now();
+}
+
+void TimerRegistry::end()
+{
+  // an unbalanced end (more ends than begins) is ignored rather than corrupting the tree
+  if( !isMainThread() || currentNode->parent == nullptr )
+  {
+    return;
+  }
+
+  std::chrono::duration< real64 > const elapsed = std::chrono::steady_clock::now() - currentNode->start;
+  currentNode->time += elapsed.count();
+  ++currentNode->count;
+  currentNode = currentNode->parent;
+}
+
+void TimerRegistry::clear()
+{
+  rootNode().children.clear();
+  currentNode = &rootNode();
+}
+
+void TimerRegistry::report()
+{
+  std::vector< TimerNode const * > nodes;
+  std::vector< string > paths;
+  std::vector< integer > depths;
+  flattenTree( rootNode(), "", 0, nodes, paths, depths );
+
+  // the scopes of rank 0 are reported, the other ranks contribute the time of their scopes with the same path
+  string reportedPaths;
+  if( MpiWrapper::commRank( MPI_COMM_GEOSX ) == 0 )
+  {
+    for( string const & path : paths )
+    {
+      reportedPaths += path + '\n';
+    }
+  }
+  MpiWrapper::broadcast( reportedPaths, 0, MPI_COMM_GEOSX );
+  if( reportedPaths.empty() )
+  {
+    return;
+  }
+
+  std::unordered_map< string, real64 > localTimes;
+  for( std::size_t i = 0; i < nodes.size(); ++i )
+  {
+    localTimes.emplace( paths[i], nodes[i]->time );
+  }
+
+  std::vector< string > reported;
+  for( std::size_t first = 0, last = reportedPaths.find( '\n' ); last != string::npos; first = last + 1, last = reportedPaths.find( '\n', first ) )
+  {
+    reported.emplace_back( reportedPaths.substr( first, last - first ) );
+  }
+  int const numReported = LvArray::integerConversion< int >( reported.size() );
+  std::vector< real64 > minTime( numReported ), maxTime( numReported ), sumTime( numReported );
+  for( int i = 0; i < numReported; ++i )
+  {
+    auto const it = localTimes.find( reported[i] );
+    minTime[i] = ( it != localTimes.end() ) ? it->second : 0.0;
+  }
+  maxTime = minTime;
+  sumTime = minTime;
+
+  MpiWrapper::allReduce( minTime.data(), minTime.data(), numReported, MPI_MIN, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( maxTime.data(), maxTime.data(), numReported, MPI_MAX, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( sumTime.data(), sumTime.data(), numReported, MPI_SUM, MPI_COMM_GEOSX );
+
+  if( MpiWrapper::commRank( MPI_COMM_GEOSX ) != 0 )
+  {
+    return;
+  }
+
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  std::size_t nameWidth = 5;
+  for( int i = 0; i < numReported; ++i )
+  {
+    nameWidth = std::max( nameWidth, LvArray::integerConversion< std::size_t >( 2 * depths[i] ) + nodes[i]->name.size() );
+  }
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "\nTimers (seconds, {} rank(s)):", numRanks ) );
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<{}}  {:>10}  {:>12}  {:>12}  {:>12}", "Scope", nameWidth, "Calls", "Min", "Avg", "Max" ) );
+  for( int i = 0; i < numReported; ++i )
+  {
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<{}}  {:>10}  {:>12.4f}  {:>12.4f}  {:>12.4f}",
+                                 string( LvArray::integerConversion< std::size_t >( 2 * depths[i] ), ' ' ) + nodes[i]->name, nameWidth,
+                                 nodes[i]->count, minTime[i], sumTime[i] / numRanks, maxTime[i] ) );
+  }
+}
+
+} // namespace geosx
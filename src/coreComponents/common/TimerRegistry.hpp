@@ -0,0 +1,110 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TimerRegistry.hpp
+ */
+
+#ifndef GEOSX_COMMON_TIMERREGISTRY_HPP
+#define GEOSX_COMMON_TIMERREGISTRY_HPP
+
+#include <string>
+
+namespace geosx
+{
+
+/**
+ * @class TimerRegistry
+ * @brief Built-in registry of the scopes marked with the GEOSX_MARK_* macros, used when Caliper is not available.
+ *
+ * The timed scopes are stored in a tree (a scope entered while another one is active is a child of the latter),
+ * each node accumulating the number of calls and the elapsed time measured with std::chrono::steady_clock.
+ * Only the thread that started the program records its scopes: the scopes entered by worker threads (e.g. inside
+ * a parallel loop) are ignored, which keeps the registry lock-free and the tree independent of the threading.
+ *
+ * When the --timers option is given, main() calls report() after a successful run: it aggregates the timers
+ * across the ranks and prints the tree with the min/avg/max time of each scope on rank 0.
+ */
+class TimerRegistry
+{
+public:
+
+  /**
+   * @brief Start timing a scope, as a child of the currently active scope.
+   * @param[in] name the name of the scope
+   */
+  static void begin( char const * name );
+
+  /**
+   * @brief Start timing a scope, as a child of the currently active scope.
+   * @param[in] name the name of the scope
+   */
+  static void begin( std::string const & name )
+  { begin( name.c_str() ); }
+
+  /**
+   * @brief Stop timing the currently active scope and make its parent active again.
+   */
+  static void end();
+
+  /**
+   * @brief Aggregate the timers across the ranks of MPI_COMM_GEOSX and print them on rank 0.
+   * @note This is a collective call. Only the scopes timed on rank 0 are reported.
+   */
+  static void report();
+
+  /**
+   * @brief Discard all the recorded timers.
+   */
+  static void clear();
+
+  /**
+   * @class ScopedTimer
+   * @brief Time the enclosing scope (RAII wrapper around begin() and end()).
+   */
+  class ScopedTimer
+  {
+public:
+
+    /**
+     * @brief Constructor, starts timing the scope.
+     * @param[in] name the name of the scope
+     */
+    explicit ScopedTimer( char const * name )
+    { begin( name ); }
+
+    /**
+     * @brief Constructor, starts timing the scope.
+     * @param[in] name the name of the scope
+     */
+    explicit ScopedTimer( std::string const & name )
+    { begin( name ); }
+
+    /**
+     * @brief Destructor, stops timing the scope.
+     */
+    ~ScopedTimer()
+    { end(); }
+
+    /// Deleted copy constructor.
+    ScopedTimer( ScopedTimer const & ) = delete;
+
+    /// Deleted copy assignment.
+    ScopedTimer & operator=( ScopedTimer const & ) = delete;
+  };
+};
+
+} // namespace geosx
+
+#endif // GEOSX_COMMON_TIMERREGISTRY_HPP
@@ -19,7 +19,7 @@
 /**
  * @file TimingMacros.hpp
  *
- * A collection of timing-related macros that wrap Caliper.
+ * A collection of timing-related macros that wrap Caliper, or the built-in TimerRegistry when Caliper is not used.
  */
 
 #ifndef GEOSX_COMMON_TIMINGMACROS_HPP_
@@ -28,8 +28,6 @@
 #include "common/GeosxConfig.hpp"
 #include "GeosxMacros.hpp"
 
-#ifdef GEOSX_USE_CALIPER
-#include <caliper/cali.h>
 #include <sys/time.h>
 #include <string>
 #include <iostream>
@@ -45,9 +43,15 @@ namespace timingHelpers
   }
 }
 
+#ifdef GEOSX_USE_CALIPER
+#include <caliper/cali.h>
+
 /// Mark a function or scope for timing with a given name
 #define GEOSX_MARK_SCOPE(name) cali::Function __cali_ann##__LINE__(STRINGIZE_NX(name))
 
+/// Mark a scope for timing with a name only known at runtime (any expression convertible to std::string)
+#define GEOSX_MARK_SCOPE_STRING(name) cali::Function __cali_ann##__LINE__(std::string(name).c_str())
+
 /// Mark a function for timing using a compiler-provided name
 #define GEOSX_MARK_FUNCTION cali::Function __cali_ann##__func__(timingHelpers::stripPF(__PRETTY_FUNCTION__).c_str())
 
@@ -65,16 +69,24 @@ namespace timingHelpers
 
 #else // GEOSX_USE_CALIPER
 
+// Without Caliper, the marked scopes are timed by the built-in registry and reported at the end of the run.
+#include "common/TimerRegistry.hpp"
+
 /// @cond DO_NOT_DOCUMENT
-#define GEOSX_MARK_SCOPE(name)
+#define GEOSX_MARK_SCOPE(name) geosx::TimerRegistry::ScopedTimer __timer_ann##__LINE__(STRINGIZE_NX(name))
+#define GEOSX_MARK_SCOPE_STRING(name) geosx::TimerRegistry::ScopedTimer __timer_ann##__LINE__(std::string(name))
 #define GEOSX_MARK_FUNCTION_SCOPED
-#define GEOSX_MARK_FUNCTION
 
-#define GEOSX_MARK_BEGIN(name)
-#define GEOSX_MARK_END(name)
+// the name is only computed on the first call of the function
+#define GEOSX_MARK_FUNCTION \
+  static std::string const __timer_name##__func__ = timingHelpers::stripPF(__PRETTY_FUNCTION__); \
+  geosx::TimerRegistry::ScopedTimer __timer_ann##__func__(__timer_name##__func__)
+
+#define GEOSX_MARK_BEGIN(name) geosx::TimerRegistry::begin(STRINGIZE(name))
+#define GEOSX_MARK_END(name) geosx::TimerRegistry::end()
 
-#define GEOSX_MARK_FUNCTION_BEGIN
-#define GEOSX_MARK_FUNCTION_END
+#define GEOSX_MARK_FUNCTION_BEGIN geosx::TimerRegistry::begin(timingHelpers::stripPF(__PRETTY_FUNCTION__))
+#define GEOSX_MARK_FUNCTION_END geosx::TimerRegistry::end()
 /// @endcond
 
 #endif // GEOSX_USE_CALIPER
@@ -15,6 +15,7 @@
 #include "initializeEnvironment.hpp"
 
 #include "TimingMacros.hpp"
+#include "BufferAllocator.hpp"
 #include "Path.hpp"
 #include "LvArray/src/system.hpp"
 
@@ -27,6 +28,7 @@
 #endif
 
 // System includes
+#include <csignal>
 #include <iomanip>
 
 #if defined( GEOSX_USE_MKL )
@@ -88,6 +90,31 @@ void setupLvArray()
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Set by the SIGUSR1 handler, consumed by the event loop.
+static volatile std::sig_atomic_t memoryReportRequested = 0;
+
+/// True iff the SIGUSR1 handler was installed and must be reset on cleanup.
+static bool memoryReportSignalInstalled = false;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void setupMemoryReportSignal()
+{
+  std::signal( SIGUSR1, []( int const ) { memoryReportRequested = 1; } );
+  memoryReportSignalInstalled = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool consumeMemoryReportRequest()
+{
+  if( memoryReportRequested == 0 )
+  {
+    return false;
+  }
+  memoryReportRequested = 0;
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void setupMKL()
 {
@@ -274,6 +301,19 @@ static void addUmpireHighWaterMarks()
     pushStatsIntoAdiak( allocatorName + " sum across ranks", mark );
     pushStatsIntoAdiak( allocatorName + " rank max", mark );
   }
+
+#if defined( GEOSX_USE_CHAI )
+  // The communication buffers share the Host or Pinned allocator with the other allocations, report them separately.
+  std::size_t const bufferMark = getBufferHighWatermark();
+  std::size_t const totalBufferMark = MpiWrapper::sum( bufferMark );
+  std::size_t const maxBufferMark = MpiWrapper::max( bufferMark );
+  GEOSX_LOG_RANK_0( "Buffers " << std::setw( 14 ) << "" << " sum across ranks: " <<
+                    std::setw( 9 ) << LvArray::system::calculateSize( totalBufferMark ) );
+  GEOSX_LOG_RANK_0( "Buffers " << std::setw( 14 ) << "" << "         rank max: " <<
+                    std::setw( 9 ) << LvArray::system::calculateSize( maxBufferMark ) );
+
+  pushStatsIntoAdiak( "Buffers high water mark", bufferMark );
+#endif
 }
 
 
@@ -291,6 +331,11 @@ void setupEnvironment( int argc, char * argv[] )
 void cleanupEnvironment()
 {
   LvArray::system::resetSignalHandling();
+  if( memoryReportSignalInstalled )
+  {
+    std::signal( SIGUSR1, SIG_DFL );
+    memoryReportSignalInstalled = false;
+  }
   finalizeLogger();
   addUmpireHighWaterMarks();
   finalizeCaliper();
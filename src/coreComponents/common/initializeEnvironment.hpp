@@ -82,6 +82,10 @@ struct CommandLineOptions
 
   /// Suppress logging of host-device data migration.
   integer suppressMoveLogging = false;
+
+  /// Print the memory allocated by the data repository at the end of the run,
+  /// and on the ranks receiving SIGUSR1.
+  integer memoryReport = false;
 };
 
 /**
@@ -105,6 +109,19 @@ void finalizeCaliper();
  */
 void setupLvArray();
 
+/**
+ * @brief Install a SIGUSR1 handler requesting a report of the memory allocated on the signaled rank.
+ * @note The handler replaces the default action of SIGUSR1 (termination), it is only installed
+ *   when requested with the --memory-report command line option.
+ */
+void setupMemoryReportSignal();
+
+/**
+ * @brief Check whether a memory report was requested with SIGUSR1 since the last call.
+ * @return true if a report was requested, in which case the request is reset.
+ */
+bool consumeMemoryReportRequest();
+
 /**
  * @brief Setup MKL if in use.
  */
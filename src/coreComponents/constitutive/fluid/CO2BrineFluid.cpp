@@ -17,9 +17,12 @@
  */
 #include "CO2BrineFluid.hpp"
 
+#include "common/Path.hpp"
 #include "constitutive/fluid/MultiFluidExtrinsicData.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 
+#include <sstream>
+
 namespace geosx
 {
 
@@ -126,6 +129,8 @@ deliverClone( string const & name, Group * const parent ) const
   CO2BrineFluid & newConstitutiveRelation = dynamicCast< CO2BrineFluid & >( *clone );
   newConstitutiveRelation.m_p1Index = m_p1Index;
   newConstitutiveRelation.m_p2Index = m_p2Index;
+  newConstitutiveRelation.m_phasePVTParaFileContents = m_phasePVTParaFileContents;
+  newConstitutiveRelation.m_flashModelParaFileContents = m_flashModelParaFileContents;
 
   newConstitutiveRelation.createPVTModels();
 
@@ -164,6 +169,20 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::postProcessInput()
   string const expectedGasPhaseNames[] = { "CO2", "co2", "gas", "Gas" };
   m_p2Index = PVTFunctionHelpers::findName( m_phaseNames, expectedGasPhaseNames, viewKeyStruct::phaseNamesString() );
 
+  // Read the parameter files on rank 0 only and broadcast them, the clones reuse their contents
+  m_phasePVTParaFileContents.resize( m_phasePVTParaFiles.size() );
+  for( localIndex i = 0; i < m_phasePVTParaFiles.size(); ++i )
+  {
+    string const & fileName = m_phasePVTParaFiles[i];
+    GEOSX_THROW_IF( !readFileCollectively( fileName, m_phasePVTParaFileContents[i] ),
+                    GEOSX_FMT( "{}: could not read file {}", getFullName(), fileName ),
+                    InputError );
+  }
+  string const & flashFileName = m_flashModelParaFile;
+  GEOSX_THROW_IF( !readFileCollectively( flashFileName, m_flashModelParaFileContents ),
+                  GEOSX_FMT( "{}: could not read file {}", getFullName(), flashFileName ),
+                  InputError );
+
   createPVTModels();
 }
 
@@ -179,9 +198,9 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
   phase2InputParams.resize( 4 );
 
   // 1) Create the viscosity, density, enthalpy, and internal energy models
-  for( string const & filename : m_phasePVTParaFiles )
+  for( string const & fileContents : m_phasePVTParaFileContents )
   {
-    std::ifstream is( filename );
+    std::istringstream is( fileContents );
     string str;
     while( std::getline( is, str ) )
     {
@@ -236,7 +255,6 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
         GEOSX_THROW( GEOSX_FMT( "{}: invalid PVT function type '{}'", getFullName(), strs[0] ), InputError );
       }
     }
-    is.close();
   }
 
   // at this point, we have read the file and we check the consistency of non-thermal models
@@ -277,7 +295,7 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
 
   // 2) Create the flash model
   {
-    std::ifstream is( m_flashModelParaFile );
+    std::istringstream is( m_flashModelParaFileContents );
     string str;
     while( std::getline( is, str ) )
     {
@@ -298,7 +316,6 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
         GEOSX_THROW( GEOSX_FMT( "{}: invalid flash model type '{}'", getFullName(), strs[0] ), InputError );
       }
     }
-    is.close();
   }
 
   GEOSX_THROW_IF( m_flash == nullptr,
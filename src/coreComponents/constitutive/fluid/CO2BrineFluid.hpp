@@ -105,6 +105,26 @@ public:
                          real64 const temperature,
                          arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const override;
 
+    /// Number of cells whose properties are evaluated together by updateBatch
+    static constexpr localIndex batchSize = 16;
+
+    /**
+     * @brief Update the fluid properties of a batch of consecutive cells (host only)
+     * @param[in] firstElem the index of the first cell of the batch
+     * @param[in] numElems the number of cells in the batch, at most batchSize
+     * @param[in] pressure the pressures of the cells of the batch
+     * @param[in] temperature the temperatures of the cells of the batch
+     * @param[in] composition the component fractions of all the cells
+     *
+     * The flash and each PVT function are evaluated for all the cells of the batch before moving to the next one,
+     * so that the tables of a function stay in cache while it runs. The results are identical to those of update.
+     */
+    void updateBatch( localIndex const firstElem,
+                      localIndex const numElems,
+                      real64 const * const pressure,
+                      real64 const * const temperature,
+                      arrayView2d< real64 const, compflow::USD_COMP > const & composition ) const;
+
 private:
 
     friend class CO2BrineFluid;
@@ -125,6 +145,55 @@ private:
                    PhaseComp::ViewType phaseCompFraction,
                    FluidProp::ViewType totalDensity );
 
+    /**
+     * @brief Convert the properties to mass variables if needed and compute the total density (last step of compute)
+     * @param[in] pressure the pressure
+     * @param[in] temperatureInCelsius the temperature in Celsius
+     * @param[in] dCompMoleFrac_dCompMassFrac the derivatives of mole fractions wrt mass fractions
+     * @param[inout] phaseFraction the phase fractions (+ derivatives)
+     * @param[inout] phaseDensity the phase densities (+ derivatives)
+     * @param[out] phaseMassDensity the phase mass densities (+ derivatives)
+     * @param[inout] phaseViscosity the phase viscosities (+ derivatives)
+     * @param[inout] phaseEnthalpy the phase enthalpies (+ derivatives)
+     * @param[inout] phaseInternalEnergy the phase internal energies (+ derivatives)
+     * @param[inout] phaseCompFraction the phase component fractions (+ derivatives)
+     * @param[out] totalDensity the total density (+ derivatives)
+     */
+    GEOSX_HOST_DEVICE
+    void computeMassVariablesAndTotalDensity( real64 const pressure,
+                                              real64 const temperatureInCelsius,
+                                              real64 const (&dCompMoleFrac_dCompMassFrac)[2][2],
+                                              PhaseProp::SliceType const phaseFraction,
+                                              PhaseProp::SliceType const phaseDensity,
+                                              PhaseProp::SliceType const phaseMassDensity,
+                                              PhaseProp::SliceType const phaseViscosity,
+                                              PhaseProp::SliceType const phaseEnthalpy,
+                                              PhaseProp::SliceType const phaseInternalEnergy,
+                                              PhaseComp::SliceType const phaseCompFraction,
+                                              FluidProp::SliceType const totalDensity ) const;
+
+    /**
+     * @brief Evaluate one PVT function of phase ip for all the cells of a batch
+     * @tparam PVT_WRAPPER the type of the PVT function kernel wrapper
+     * @param[in] pvtWrapper the PVT function kernel wrapper
+     * @param[in] ip the index of the phase
+     * @param[in] firstElem the index of the first cell of the batch
+     * @param[in] numElems the number of cells in the batch
+     * @param[in] q the index of the quadrature point
+     * @param[in] pressure the pressures of the cells of the batch
+     * @param[in] temperatureInCelsius the temperatures in Celsius of the cells of the batch
+     * @param[in] property the view on the phase property computed by the PVT function
+     */
+    template< typename PVT_WRAPPER >
+    void computeBatch( PVT_WRAPPER const & pvtWrapper,
+                       integer const ip,
+                       localIndex const firstElem,
+                       localIndex const numElems,
+                       localIndex const q,
+                       real64 const * const pressure,
+                       real64 const * const temperatureInCelsius,
+                       PhaseProp::ViewType const & property ) const;
+
     /// Index of the liquid phase
     integer m_p1Index;
 
@@ -181,6 +250,12 @@ private:
   /// Name of the file defining the flash model
   Path m_flashModelParaFile;
 
+  /// Contents of the files defining the viscosity and density models, read once and shared with the clones
+  string_array m_phasePVTParaFileContents;
+
+  /// Contents of the file defining the flash model, read once and shared with the clones
+  string m_flashModelParaFileContents;
+
   /// Index of the liquid phase
   integer m_p1Index;
 
@@ -387,7 +462,6 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
            FluidProp::SliceType const totalDensity ) const
 {
   integer constexpr numComp = 2;
-  integer constexpr numPhase = 2;
   integer const ip1 = m_p1Index;
   integer const ip2 = m_p2Index;
 
@@ -467,7 +541,65 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
                                    phaseInternalEnergy.value[ip2], phaseInternalEnergy.derivs[ip2],
                                    m_useMass );
 
-  // 5. Depending on the m_useMass flag, convert to mass variables or simply compute mass density
+  // 5. Convert to mass variables if needed and compute the total density
+
+  computeMassVariablesAndTotalDensity( pressure,
+                                       temperatureInCelsius,
+                                       dCompMoleFrac_dCompMassFrac,
+                                       phaseFraction,
+                                       phaseDensity,
+                                       phaseMassDensity,
+                                       phaseViscosity,
+                                       phaseEnthalpy,
+                                       phaseInternalEnergy,
+                                       phaseCompFraction,
+                                       totalDensity );
+}
+
+template< typename PHASE1, typename PHASE2, typename FLASH >
+GEOSX_HOST_DEVICE inline void
+CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
+  update( localIndex const k,
+          localIndex const q,
+          real64 const pressure,
+          real64 const temperature,
+          arraySlice1d< geosx::real64 const, compflow::USD_COMP - 1 > const & composition ) const
+{
+  compute( pressure,
+           temperature,
+           composition,
+           m_phaseFraction( k, q ),
+           m_phaseDensity( k, q ),
+           m_phaseMassDensity( k, q ),
+           m_phaseViscosity( k, q ),
+           m_phaseEnthalpy( k, q ),
+           m_phaseInternalEnergy( k, q ),
+           m_phaseCompFraction( k, q ),
+           m_totalDensity( k, q ) );
+}
+
+template< typename PHASE1, typename PHASE2, typename FLASH >
+GEOSX_HOST_DEVICE
+inline void
+CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
+  computeMassVariablesAndTotalDensity( real64 const pressure,
+                                       real64 const temperatureInCelsius,
+                                       real64 const (&dCompMoleFrac_dCompMassFrac)[2][2],
+                                       PhaseProp::SliceType const phaseFraction,
+                                       PhaseProp::SliceType const phaseDensity,
+                                       PhaseProp::SliceType const phaseMassDensity,
+                                       PhaseProp::SliceType const phaseViscosity,
+                                       PhaseProp::SliceType const phaseEnthalpy,
+                                       PhaseProp::SliceType const phaseInternalEnergy,
+                                       PhaseComp::SliceType const phaseCompFraction,
+                                       FluidProp::SliceType const totalDensity ) const
+{
+  integer constexpr numComp = 2;
+  integer constexpr numPhase = 2;
+  integer const ip1 = m_p1Index;
+  integer const ip2 = m_p2Index;
+
+  // 1. Depending on the m_useMass flag, convert to mass variables or simply compute mass density
 
   // TODO: for now the treatment of molar/mass density requires too many interpolations in the tables, it needs to be fixed
   //       we should modify the PVT functions so that they can return phaseMassDens, phaseDens, and phaseMW in one call
@@ -475,7 +607,7 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
   if( m_useMass )
   {
 
-    // 4.1 Compute the phase molecular weights (ultimately, get that from the PVT function)
+    // 1.1 Compute the phase molecular weights (ultimately, get that from the PVT function)
 
     real64 phaseMolecularWeight[numPhase]{};
     real64 dPhaseMolecularWeight[numPhase][numComp+2]{};
@@ -505,7 +637,7 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
       dPhaseMolecularWeight[ip2][idof] = phaseDensity.derivs[ip2][idof] / phaseMolarDens - phaseMolecularWeight[ip2] * dPhaseMolarDens[idof] / phaseMolarDens;
     }
 
-    // 4.2 Convert the mole fractions to mass fractions
+    // 1.2 Convert the mole fractions to mass fractions
     convertToMassFractions( dCompMoleFrac_dCompMassFrac,
                             phaseMolecularWeight,
                             dPhaseMolecularWeight,
@@ -517,7 +649,7 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
                             phaseInternalEnergy.derivs );
 
 
-    // 4.3 Copy the phase densities into the phase mass densities
+    // 1.3 Copy the phase densities into the phase mass densities
     for( integer ip = 0; ip < numPhase; ++ip )
     {
       phaseMassDensity.value[ip] = phaseDensity.value[ip];
@@ -542,7 +674,7 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
                               true );
   }
 
-  // 5. Compute total fluid mass/molar density and derivatives
+  // 2. Compute total fluid mass/molar density and derivatives
 
   computeTotalDensity( phaseFraction,
                        phaseDensity,
@@ -550,25 +682,111 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
 }
 
 template< typename PHASE1, typename PHASE2, typename FLASH >
-GEOSX_HOST_DEVICE inline void
+template< typename PVT_WRAPPER >
+inline void
 CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
-  update( localIndex const k,
-          localIndex const q,
-          real64 const pressure,
-          real64 const temperature,
-          arraySlice1d< geosx::real64 const, compflow::USD_COMP - 1 > const & composition ) const
+  computeBatch( PVT_WRAPPER const & pvtWrapper,
+                integer const ip,
+                localIndex const firstElem,
+                localIndex const numElems,
+                localIndex const q,
+                real64 const * const pressure,
+                real64 const * const temperatureInCelsius,
+                PhaseProp::ViewType const & property ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ) );
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    localIndex const k = firstElem + i;
+    PhaseComp::SliceType const phaseCompFraction = m_phaseCompFraction( k, q );
+    PhaseProp::SliceType const phaseProperty = property( k, q );
+    pvtWrapper.compute( pressure[i],
+                        temperatureInCelsius[i],
+                        phaseCompFraction.value[ip].toSliceConst(), phaseCompFraction.derivs[ip].toSliceConst(),
+                        phaseProperty.value[ip], phaseProperty.derivs[ip],
+                        m_useMass );
+  }
+}
+
+template< typename PHASE1, typename PHASE2, typename FLASH >
+inline void
+CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
+  updateBatch( localIndex const firstElem,
+               localIndex const numElems,
+               real64 const * const pressure,
+               real64 const * const temperature,
+               arrayView2d< real64 const, compflow::USD_COMP > const & composition ) const
+{
+  integer constexpr numComp = 2;
+  GEOSX_ASSERT( numElems <= batchSize );
+
+  // 1. Convert input mass fractions to mole fractions and keep derivatives, for all the cells of the batch
+
+  real64 temperatureInCelsius[batchSize]{};
+  stackArray2d< real64, batchSize * numComp > compMoleFrac( batchSize, numComp );
+  real64 dCompMoleFrac_dCompMassFrac[batchSize][numComp][numComp]{};
+
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    temperatureInCelsius[i] = temperature[i] - 273.15;
+    if( m_useMass )
+    {
+      convertToMoleFractions( composition[firstElem + i],
+                              compMoleFrac[i],
+                              dCompMoleFrac_dCompMassFrac[i] );
+    }
+    else
+    {
+      for( integer ic = 0; ic < numComp; ++ic )
+      {
+        compMoleFrac[i][ic] = composition[firstElem + i][ic];
+      }
+    }
+  }
+
+  for( localIndex q = 0; q < numGauss(); ++q )
+  {
+    // 2. Compute phase fractions and phase component fractions
+
+    for( localIndex i = 0; i < numElems; ++i )
+    {
+      localIndex const k = firstElem + i;
+      m_flash.compute( pressure[i],
+                       temperatureInCelsius[i],
+                       compMoleFrac[i].toSliceConst(),
+                       m_phaseFraction( k, q ),
+                       m_phaseCompFraction( k, q ) );
+    }
+
+    // 3. Compute phase densities, phase viscosities, enthalpies and internal energies, one PVT function at a time
+
+    computeBatch( m_phase1.density, m_p1Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseDensity );
+    computeBatch( m_phase1.viscosity, m_p1Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseViscosity );
+    computeBatch( m_phase2.density, m_p2Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseDensity );
+    computeBatch( m_phase2.viscosity, m_p2Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseViscosity );
+
+    computeBatch( m_phase1.enthalpy, m_p1Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseEnthalpy );
+    computeBatch( m_phase1.internalEnergy, m_p1Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseInternalEnergy );
+    computeBatch( m_phase2.enthalpy, m_p2Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseEnthalpy );
+    computeBatch( m_phase2.internalEnergy, m_p2Index, firstElem, numElems, q, pressure, temperatureInCelsius, m_phaseInternalEnergy );
+
+    // 4. Convert to mass variables if needed and compute the total density
+
+    for( localIndex i = 0; i < numElems; ++i )
+    {
+      localIndex const k = firstElem + i;
+      computeMassVariablesAndTotalDensity( pressure[i],
+                                           temperatureInCelsius[i],
+                                           dCompMoleFrac_dCompMassFrac[i],
+                                           m_phaseFraction( k, q ),
+                                           m_phaseDensity( k, q ),
+                                           m_phaseMassDensity( k, q ),
+                                           m_phaseViscosity( k, q ),
+                                           m_phaseEnthalpy( k, q ),
+                                           m_phaseInternalEnergy( k, q ),
+                                           m_phaseCompFraction( k, q ),
+                                           m_totalDensity( k, q ) );
+    }
+  }
 }
 
 /// Declare strings associated with enumeration values
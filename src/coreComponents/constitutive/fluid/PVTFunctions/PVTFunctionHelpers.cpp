@@ -17,6 +17,7 @@
  */
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/Path.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "LvArray/src/sortedArrayManipulation.hpp"
 
@@ -34,9 +35,11 @@ BlackOilTables::readTable( string const & fileName,
                            integer minRowLength,
                            array1d< array1d< real64 > > & data )
 {
-  std::ifstream is( fileName );
-  GEOSX_ERROR_IF( !is.is_open(),
+  // The file is read on rank 0 only and its contents are broadcast
+  string fileContents;
+  GEOSX_ERROR_IF( !readFileCollectively( fileName, fileContents ),
                   "BlackOilTables: could not open file: " << fileName );
+  std::istringstream is( fileContents );
 
   // Read line-by-line until eof
   string str;
@@ -63,8 +66,6 @@ BlackOilTables::readTable( string const & fileName,
     }
   }
 
-  is.close();
-
   for( localIndex i = 0; i < data.size(); ++i )
   {
     GEOSX_ERROR_IF( data[i].size() < minRowLength,
@@ -44,6 +44,7 @@ public:
    * @param[in] fileName the name of the file
    * @param[in] minRowLength the expected minimum row length (3 for water, 4 for gas and oil)
    * @param[out] data the data from the table
+   * @note This is a collective call: the file is read on rank 0 and its contents are broadcast.
    */
   static void
   readTable( string const & fileName,
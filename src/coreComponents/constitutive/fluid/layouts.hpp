@@ -43,7 +43,10 @@ struct DerivativeOffset
   static integer constexpr dC = 2;
 };
 
-#if defined( GEOSX_USE_CUDA )
+// The cell index is the unit-stride dimension on GPUs (coalesced accesses across threads),
+// and optionally on CPUs (vectorization across cells, see CMake option GEOSX_MULTIFLUID_LAYOUT).
+// Otherwise, all the properties of a cell are contiguous in memory.
+#if defined( GEOSX_USE_CUDA ) || defined( GEOSX_MULTIFLUID_LAYOUT_CELL_INNER )
 
 /// Constitutive model phase property array layout
 using LAYOUT_PHASE = RAJA::PERM_JKI;
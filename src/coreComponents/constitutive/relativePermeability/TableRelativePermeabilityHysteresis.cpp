@@ -134,6 +134,10 @@ TableRelativePermeabilityHysteresis::TableRelativePermeabilityHysteresis( std::s
   registerExtrinsicData( extrinsicMeshData::relperm::phaseMaxHistoricalVolFraction{}, &m_phaseMaxHistoricalVolFraction );
   registerExtrinsicData( extrinsicMeshData::relperm::phaseMinHistoricalVolFraction{}, &m_phaseMinHistoricalVolFraction );
 
+  registerWrapper( viewKeyStruct::scanningCurveParametersString(), &m_scanningCurveParams ).
+    setPlotLevel( PlotLevel::NOPLOT ).
+    setSizedFromParent( 0 );
+
   registerWrapper( viewKeyStruct::drainageRelPermKernelWrappersString(), &m_drainageRelPermKernelWrappers ).
     setSizedFromParent( 0 ).
     setRestartFlags( RestartFlags::NO_WRITE );
@@ -517,7 +521,8 @@ void TableRelativePermeabilityHysteresis::computeLandCoefficient()
   }
 }
 
-void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers()
+void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers( array1d< TableFunction::KernelWrapper > & drainageRelPermKernelWrappers,
+                                                                        array1d< TableFunction::KernelWrapper > & imbibitionRelPermKernelWrappers ) const
 {
   using IPT = TableRelativePermeabilityHysteresis::ImbibitionPhasePairPhaseType;
 
@@ -527,26 +532,26 @@ void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers()
 
   // we want to make sure that the wrappers are always up-to-date, so we recreate them everytime
 
-  m_drainageRelPermKernelWrappers.clear();
-  m_imbibitionRelPermKernelWrappers.clear();
+  drainageRelPermKernelWrappers.clear();
+  imbibitionRelPermKernelWrappers.clear();
 
   if( numPhases == 2 )
   {
     for( integer ip = 0; ip < m_drainageWettingNonWettingRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
     }
 
     TableFunction const & imbibitionWettingRelPermTable = m_phaseHasHysteresis[IPT::WETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
+    imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
 
     TableFunction const & imbibitionNonWettingRelPermTable = m_phaseHasHysteresis[IPT::NONWETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionNonWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[1] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
+    imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
 
   }
   else if( numPhases == 3 )
@@ -554,23 +559,23 @@ void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers()
     for( integer ip = 0; ip < m_drainageWettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageWettingIntermediateRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
     }
     for( integer ip = 0; ip < m_drainageNonWettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageNonWettingIntermediateRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
     }
 
     TableFunction const & imbibitionWettingRelPermTable = m_phaseHasHysteresis[IPT::WETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingIntermediateRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
+    imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
 
     TableFunction const & imbibitionNonWettingRelPermTable = m_phaseHasHysteresis[IPT::NONWETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionNonWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageNonWettingIntermediateRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
+    imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
   }
 
 }
@@ -580,11 +585,19 @@ TableRelativePermeabilityHysteresis::createKernelWrapper()
 {
 
   // we want to make sure that the wrappers are always up-to-date, so we recreate them everytime
-  createAllTableKernelWrappers();
+  createAllTableKernelWrappers( m_drainageRelPermKernelWrappers, m_imbibitionRelPermKernelWrappers );
 
   // then we create the actual TableRelativePermeabilityHysteresis::KernelWrapper
-  return KernelWrapper( m_drainageRelPermKernelWrappers,
-                        m_imbibitionRelPermKernelWrappers,
+  return createKernelWrapper( m_drainageRelPermKernelWrappers.toViewConst(),
+                              m_imbibitionRelPermKernelWrappers.toViewConst() );
+}
+
+TableRelativePermeabilityHysteresis::KernelWrapper
+TableRelativePermeabilityHysteresis::createKernelWrapper( arrayView1d< TableFunction::KernelWrapper const > const & drainageRelPermKernelWrappers,
+                                                          arrayView1d< TableFunction::KernelWrapper const > const & imbibitionRelPermKernelWrappers ) const
+{
+  return KernelWrapper( drainageRelPermKernelWrappers,
+                        imbibitionRelPermKernelWrappers,
                         m_jerauldParam_a,
                         m_jerauldParam_b,
                         m_killoughCurvatureParam,
@@ -600,8 +613,9 @@ TableRelativePermeabilityHysteresis::createKernelWrapper()
                         m_phaseOrder,
                         m_phaseMinHistoricalVolFraction,
                         m_phaseMaxHistoricalVolFraction,
-                        m_phaseRelPerm,
-                        m_dPhaseRelPerm_dPhaseVolFrac );
+                        m_scanningCurveParams,
+                        m_phaseRelPerm.toView(),
+                        m_dPhaseRelPerm_dPhaseVolFrac.toView() );
 }
 
 void TableRelativePermeabilityHysteresis::resizeFields( localIndex const size, localIndex const numPts )
@@ -614,6 +628,9 @@ void TableRelativePermeabilityHysteresis::resizeFields( localIndex const size, l
   m_phaseMinHistoricalVolFraction.resize( size, numPhases );
   m_phaseMaxHistoricalVolFraction.setValues< parallelDevicePolicy<> >( 0.0 );
   m_phaseMinHistoricalVolFraction.setValues< parallelDevicePolicy<> >( 1.0 );
+
+  m_scanningCurveParams.resize( size, 2, ScanningCurveParamType::NUM_PARAMS );
+  m_scanningCurveParams.setValues< parallelDevicePolicy<> >( 0.0 );
 }
 
 void TableRelativePermeabilityHysteresis::saveConvergedPhaseVolFractionState( arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFraction ) const
@@ -633,6 +650,22 @@ void TableRelativePermeabilityHysteresis::saveConvergedPhaseVolFractionState( ar
     }
   } );
 
+  // the scanning curves only depend on the historical volume fractions, so we update them here once per time step
+  // instead of recomputing the trapped saturations and the drainage values at the historical saturations in each relperm update
+  array1d< TableFunction::KernelWrapper > drainageRelPermKernelWrappers;
+  array1d< TableFunction::KernelWrapper > imbibitionRelPermKernelWrappers;
+  createAllTableKernelWrappers( drainageRelPermKernelWrappers, imbibitionRelPermKernelWrappers );
+
+  KernelWrapper const kernelWrapper = createKernelWrapper( drainageRelPermKernelWrappers.toViewConst(),
+                                                           imbibitionRelPermKernelWrappers.toViewConst() );
+  arrayView3d< real64 > const scanningCurveParams = m_scanningCurveParams.toView();
+
+  forAll< parallelDevicePolicy<> >( numElems, [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+  {
+    kernelWrapper.computeScanningCurves( phaseMaxHistoricalVolFraction[ei],
+                                         phaseMinHistoricalVolFraction[ei],
+                                         scanningCurveParams[ei] );
+  } );
 }
 
 TableRelativePermeabilityHysteresis::KernelWrapper::
@@ -653,6 +686,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                  arrayView1d< integer const > const & phaseOrder,
                  arrayView2d< real64 const, compflow::USD_PHASE > const & phaseMinHistoricalVolFraction,
                  arrayView2d< real64 const, compflow::USD_PHASE > const & phaseMaxHistoricalVolFraction,
+                 arrayView3d< real64 const > const & scanningCurveParams,
                  arrayView3d< real64, relperm::USD_RELPERM > const & phaseRelPerm,
                  arrayView4d< real64, relperm::USD_RELPERM_DS > const & dPhaseRelPerm_dPhaseVolFrac )
   : RelativePermeabilityBaseUpdate( phaseTypes,
@@ -673,7 +707,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   m_drainagePhaseRelPermEndPoint( drainagePhaseRelPermEndPoint ),
   m_imbibitionPhaseRelPermEndPoint( imbibitionPhaseRelPermEndPoint ),
   m_phaseMinHistoricalVolFraction( phaseMinHistoricalVolFraction ),
-  m_phaseMaxHistoricalVolFraction( phaseMaxHistoricalVolFraction )
+  m_phaseMaxHistoricalVolFraction( phaseMaxHistoricalVolFraction ),
+  m_scanningCurveParams( scanningCurveParams )
 {}
 
 
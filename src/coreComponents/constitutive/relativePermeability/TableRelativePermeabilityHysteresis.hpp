@@ -65,6 +65,20 @@ public:
   };
 
 
+  /// order of the scanning curve parameters stored for each element and each phase in the imbibition data
+  struct ScanningCurveParamType
+  {
+    enum : integer
+    {
+      MIN_VOL_FRACTION = 0, ///< volume fraction below which the relperm is zero
+      SNORM_INTERCEPT = 1,  ///< intercept of the normalized volume fraction at which the imbibition table is evaluated
+      SNORM_SLOPE = 2,      ///< slope of the normalized volume fraction wrt the phase volume fraction (zero if there is no scanning curve)
+      REL_PERM_OFFSET = 3,  ///< relperm added to the scaled imbibition relperm
+      REL_PERM_SCALE = 4,   ///< scaling factor applied to the imbibition relperm
+      NUM_PARAMS = 5        ///< number of scanning curve parameters
+    };
+  };
+
   TableRelativePermeabilityHysteresis( std::string const & name, dataRepository::Group * const parent );
 
   static std::string catalogName() { return "TableRelativePermeabilityHysteresis"; }
@@ -104,6 +118,7 @@ public:
      * @param[in] phaseOrder the phase order
      * @param[in] phaseMinHistoricalPhaseVolFraction minimum historical saturation for each phase
      * @param[in] phaseMaxHistoricalPhaseVolFraction maximum historical saturation for each phase
+     * @param[in] scanningCurveParams scanning curve parameters for the wetting and non-wetting phase in each element
      * @param[out] phaseRelPerm relative permeability for each phase
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivative of relative permeability wrt phase volume fraction for each phase
      */
@@ -124,6 +139,7 @@ public:
                    arrayView1d< integer const > const & phaseOrder,
                    arrayView2d< real64 const, compflow::USD_PHASE > const & phaseMinHistoricalVolFraction,
                    arrayView2d< real64 const, compflow::USD_PHASE > const & phaseMaxHistoricalVolFraction,
+                   arrayView3d< real64 const > const & scanningCurveParams,
                    arrayView3d< real64, relperm::USD_RELPERM > const & phaseRelPerm,
                    arrayView4d< real64, relperm::USD_RELPERM_DS > const & dPhaseRelPerm_dPhaseVolFrac );
 
@@ -142,68 +158,95 @@ public:
                                  real64 & dPhaseRelPerm_dPhaseVolFrac ) const;
 
     /**
-     * @brief Function updating the relperm (and derivative) for the wetting phase in imbibition using Killough's method
+     * @brief Function telling whether a phase has a scanning curve, i.e., if its historical volume fraction is strictly inside
+     *        the imbibition range. Otherwise the phase keeps its drainage relperm.
+     * @param[in] scanningCurveParams scanning curve parameters of this phase (see ScanningCurveParamType)
+     * @return true if the phase has a scanning curve
+     */
+    GEOSX_HOST_DEVICE
+    static bool hasScanningCurve( arraySlice1d< real64 const > const & scanningCurveParams );
+
+    /**
+     * @brief Function computing the scanning curve parameters of the wetting phase using Killough's method
      * @param[in] drainageRelPermKernelWrapper kernel wrapper storing the drainage relperm table for the wetting phase
-     * @param[in] imbibitionRelPermKernelWrapper kernel wrapper storing the imbibition relperm table for the wetting phase
      * @param[in] jerauldParam_a first (modification) parameter proposed by Jerauld
      * @param[in] jerauldParam_b second (exponent) parameter proposed by Jerauld
      * @param[in] landParam Land trapping parameter
-     * @param[in] phaseVolFraction volume fraction for this phase
      * @param[in] phaseMinHistoricalVolFraction min historical volume fraction for this phase
      * @param[in] imbibitionPhaseMinWettingVolFraction imbibition minimum volume fraction for this phase
      * @param[in] drainagePhaseMaxVolFraction drainage maximum volume fraction for this phase
      * @param[in] imbibitionPhaseMaxVolFraction imbibition maximum volume fraction for this phase
-     * @param[in] drainageRelPermEndPoint drainage end-point relperm for this phase
      * @param[in] imbibitionRelPermEndPoint imbibition end-point relperm for this phase
-     * @param[out] phaseRelPerm relative permeability of the wetting phase
-     * @param[out] dPhaseRelPerm_dPhaseVolFrac derivative of the relative permeability wrt phase volume fraction for the wetting phase
+     * @param[out] scanningCurveParams scanning curve parameters of the wetting phase (see ScanningCurveParamType)
      */
     GEOSX_HOST_DEVICE
-    void computeImbibitionWettingRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
-                                          TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
-                                          real64 const & jerauldParam_a,
-                                          real64 const & jerauldParam_b,
-                                          real64 const & landParam,
-                                          real64 const & phaseVolFraction,
-                                          real64 const & phaseMinHistoricalVolFraction,
-                                          real64 const & imbibitionPhaseMinWettingVolFraction,
-                                          real64 const & drainagePhaseMaxVolFraction,
-                                          real64 const & imbibitionPhaseMaxVolFraction,
-                                          real64 const & drainageRelPermEndPoint,
-                                          real64 const & imbibitionRelPermEndPoint,
-                                          real64 & phaseRelPerm,
-                                          real64 & dPhaseRelPerm_dPhaseVolFrac ) const;
+    void computeImbibitionWettingScanningCurve( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
+                                                real64 const & jerauldParam_a,
+                                                real64 const & jerauldParam_b,
+                                                real64 const & landParam,
+                                                real64 const & phaseMinHistoricalVolFraction,
+                                                real64 const & imbibitionPhaseMinWettingVolFraction,
+                                                real64 const & drainagePhaseMaxVolFraction,
+                                                real64 const & imbibitionPhaseMaxVolFraction,
+                                                real64 const & imbibitionRelPermEndPoint,
+                                                arraySlice1d< real64 > const & scanningCurveParams ) const;
 
     /**
-     * @brief Function updating the relperm (and derivative) for the non-wetting phase in imbibition using Killough's method
+     * @brief Function computing the scanning curve parameters of the non-wetting phase using Land's and Killough's methods
      * @param[in] drainageRelPermKernelWrapper kernel wrapper storing the drainage relperm table for the non-wetting phase
-     * @param[in] imbibitionRelPermKernelWrapper kernel wrapper storing the imbibition relperm table for the non-wetting phase
      * @param[in] jerauldParam_a first (modification) parameter proposed by Jerauld
      * @param[in] jerauldParam_b second (exponent) parameter proposed by Jerauld
      * @param[in] landParam Land trapping coefficient
-     * @param[in] phaseVolFraction volume fraction for this phase
      * @param[in] phaseMaxHistoricalVolFraction max historical volume fraction for this phase
      * @param[in] drainageMinPhaseVolFraction min drainage volume fraction for this phase
      * @param[in] imbibitionMinPhaseVolFraction min imbibition volume fraction for this phase
      * @param[in] drainageMaxPhaseVolFraction max drainage volume fraction for this phase
      * @param[in] drainageRelPermEndPoint drainage end-point relperm for this phase
-     * @param[out] phaseRelPerm relative permeability of the non-wetting phase
-     * @param[out] dPhaseRelPerm_dPhaseVolFrac derivative of the relative permeability wrt phase volume fraction for the non-wetting phase
+     * @param[out] scanningCurveParams scanning curve parameters of the non-wetting phase (see ScanningCurveParamType)
      */
     GEOSX_HOST_DEVICE
-    void computeImbibitionNonWettingRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
-                                             TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
-                                             real64 const & jerauldParam_a,
-                                             real64 const & jerauldParam_b,
-                                             real64 const & landParam,
-                                             real64 const & phaseVolFraction,
-                                             real64 const & phaseMaxHistoricalVolFraction,
-                                             real64 const & drainageMinPhaseVolFraction,
-                                             real64 const & imbibitionMinPhaseVolFraction,
-                                             real64 const & drainageMaxPhaseVolFraction,
-                                             real64 const & drainageRelPermEndPoint,
-                                             real64 & phaseRelPerm,
-                                             real64 & dPhaseRelPerm_dPhaseVolFrac ) const;
+    void computeImbibitionNonWettingScanningCurve( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
+                                                   real64 const & jerauldParam_a,
+                                                   real64 const & jerauldParam_b,
+                                                   real64 const & landParam,
+                                                   real64 const & phaseMaxHistoricalVolFraction,
+                                                   real64 const & drainageMinPhaseVolFraction,
+                                                   real64 const & imbibitionMinPhaseVolFraction,
+                                                   real64 const & drainageMaxPhaseVolFraction,
+                                                   real64 const & drainageRelPermEndPoint,
+                                                   arraySlice1d< real64 > const & scanningCurveParams ) const;
+
+    /**
+     * @brief Function computing the scanning curve parameters of the wetting and non-wetting phases of an element
+     * @param[in] phaseMaxHistoricalVolFraction max historical volume fractions for all the phases
+     * @param[in] phaseMinHistoricalVolFraction min historical volume fractions for all the phases
+     * @param[out] scanningCurveParams scanning curve parameters for the wetting and non-wetting phase
+     * @detail the parameters only depend on the historical volume fractions, so this function is called when they change
+     *         (at the end of a converged time step), and not at each relperm update
+     */
+    GEOSX_HOST_DEVICE
+    void computeScanningCurves( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
+                                arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                                arraySlice2d< real64 > const & scanningCurveParams ) const;
+
+    /**
+     * @brief Function updating the relperm (and derivative) for a phase in imbibition using its precomputed scanning curve
+     * @param[in] imbibitionRelPermKernelWrapper kernel wrapper storing the imbibition relperm table for this phase
+     * @param[in] scanningCurveParams scanning curve parameters of this phase (see ScanningCurveParamType)
+     * @param[in] drainagePhaseMaxVolFraction drainage maximum volume fraction for this phase
+     * @param[in] drainageRelPermEndPoint drainage end-point relperm for this phase
+     * @param[in] phaseVolFraction volume fraction for this phase
+     * @param[out] phaseRelPerm relative permeability of the phase we want to update here
+     * @param[out] dPhaseRelPerm_dPhaseVolFrac derivative of the relative permeability wrt phase volume fraction for this phase
+     */
+    GEOSX_HOST_DEVICE
+    void computeImbibitionRelPerm( TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
+                                   arraySlice1d< real64 const > const & scanningCurveParams,
+                                   real64 const & drainagePhaseMaxVolFraction,
+                                   real64 const & drainageRelPermEndPoint,
+                                   real64 const & phaseVolFraction,
+                                   real64 & phaseRelPerm,
+                                   real64 & dPhaseRelPerm_dPhaseVolFrac ) const;
 
     /**
      * @brief Function updating all the phase relperms (and derivatives) for two-phase flow
@@ -212,6 +255,7 @@ public:
      * @param[in] phaseVolFraction
      * @param[in] phaseMaxHistoricalVolFraction
      * @param[in] phaseMinHistoricalVolFraction
+     * @param[in] scanningCurveParams
      * @param[out] phaseRelPerm
      * @param[out] dPhaseRelPerm_dPhaseVolFrac
      * @detail depending of the flow direction for a given phase, this function updates the phase relative permeability
@@ -223,6 +267,7 @@ public:
                           arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                           arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
                           arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                          arraySlice2d< real64 const > const & scanningCurveParams,
                           arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                           arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
 
@@ -234,6 +279,7 @@ public:
      * @param[in] phaseVolFraction volume fractions for the three phases
      * @param[in] phaseMaxHistoricalVolFraction max historical volume fractions for the three phases
      * @param[in] phaseMinHistoricalVolFraction min historical volume fractions for the three phases
+     * @param[in] scanningCurveParams scanning curve parameters for the wetting and non-wetting phases
      * @param[out] phaseRelPerm relative permeabilities for the three phases
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivatives of relative permeabilities wrt phase volume fraction for the three phases
      * @detail depending of the flow direction for a given phase, this function updates the phase relative permeability
@@ -246,6 +292,7 @@ public:
                             arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                             arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
                             arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                            arraySlice2d< real64 const > const & scanningCurveParams,
                             arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                             arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
 
@@ -254,6 +301,7 @@ public:
      * @param[in] phaseVolFraction volume fractions for all the phases
      * @param[in] phaseMaxHistoricalVolFraction max historical volume fractions for all the phases
      * @param[in] phaseMinHistoricalVolFraction min historical volume fractions for all the phases
+     * @param[in] scanningCurveParams scanning curve parameters for the wetting and non-wetting phases
      * @param[out] phaseRelPerm relative permeabilities for all the phases
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivatives of relative permeabilities wrt phase volume fraction for all the phases
      */
@@ -261,6 +309,7 @@ public:
     void compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                   arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
                   arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                  arraySlice2d< real64 const > const & scanningCurveParams,
                   arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                   arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
 
@@ -326,6 +375,9 @@ private:
     /// Maximum historical phase volume fraction for each phase
     arrayView2d< real64 const, compflow::USD_PHASE > m_phaseMaxHistoricalVolFraction;
 
+    /// Scanning curve parameters for the wetting and non-wetting phase
+    arrayView3d< real64 const > m_scanningCurveParams;
+
   };
 
   /**
@@ -342,6 +394,7 @@ private:
     static constexpr char const * imbibitionRelPermKernelWrappersString() { return "imbibitionRelPermWrappers"; }
 
     static constexpr char const * phaseHasHysteresisString() { return "phaseHasHysteresis"; }
+    static constexpr char const * scanningCurveParametersString() { return "scanningCurveParameters"; }
     static constexpr char const * jerauldParameterAString() { return "jerauldParameterA"; }
     static constexpr char const * jerauldParameterBString() { return "jerauldParameterB"; }
     static constexpr char const * killoughCurvatureParameterString() { return "killoughCurvatureParameter"; }
@@ -373,8 +426,20 @@ private:
 
   /**
    * @brief Create all the table kernel wrappers needed for the simulation (for all the phases present)
+   * @param[out] drainageRelPermKernelWrappers the drainage kernel wrappers
+   * @param[out] imbibitionRelPermKernelWrappers the imbibition kernel wrappers
    */
-  void createAllTableKernelWrappers();
+  void createAllTableKernelWrappers( array1d< TableFunction::KernelWrapper > & drainageRelPermKernelWrappers,
+                                     array1d< TableFunction::KernelWrapper > & imbibitionRelPermKernelWrappers ) const;
+
+  /**
+   * @brief Create an update kernel wrapper using the provided table kernel wrappers
+   * @param[in] drainageRelPermKernelWrappers the drainage kernel wrappers
+   * @param[in] imbibitionRelPermKernelWrappers the imbibition kernel wrappers
+   * @return the wrapper
+   */
+  KernelWrapper createKernelWrapper( arrayView1d< TableFunction::KernelWrapper const > const & drainageRelPermKernelWrappers,
+                                     arrayView1d< TableFunction::KernelWrapper const > const & imbibitionRelPermKernelWrappers ) const;
 
   /**
    * @brief Check whether the drainage tables exist and validate all of them
@@ -481,6 +546,9 @@ private:
   /// Maximum historical phase volume fraction for each phase
   array2d< real64, compflow::LAYOUT_PHASE > m_phaseMaxHistoricalVolFraction;
 
+  /// Scanning curve parameters for the wetting and non-wetting phase, updated when the historical volume fractions change
+  array3d< real64 > m_scanningCurveParams;
+
 };
 
 GEOSX_HOST_DEVICE
@@ -496,151 +564,235 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                                           &dPhaseRelPerm_dPhaseVolFrac );
 }
 
+GEOSX_HOST_DEVICE
+inline bool
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  hasScanningCurve( arraySlice1d< real64 const > const & scanningCurveParams )
+{
+  using SCP = TableRelativePermeabilityHysteresis::ScanningCurveParamType;
+  return scanningCurveParams[SCP::SNORM_SLOPE] > 0.0;
+}
+
 GEOSX_HOST_DEVICE
 inline void
 TableRelativePermeabilityHysteresis::KernelWrapper::
-  computeImbibitionWettingRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
-                                   TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
-                                   real64 const & jerauldParam_a,
-                                   real64 const & jerauldParam_b,
-                                   real64 const & landParam,
-                                   real64 const & phaseVolFraction,
-                                   real64 const & phaseMinHistoricalVolFraction,
-                                   real64 const & imbibitionPhaseMinWettingVolFraction,
-                                   real64 const & drainagePhaseMaxVolFraction,
-                                   real64 const & imbibitionPhaseMaxVolFraction,
-                                   real64 const & drainageRelPermEndPoint,
-                                   real64 const & imbibitionRelPermEndPoint,
-                                   real64 & phaseRelPerm,
-                                   real64 & dPhaseRelPerm_dPhaseVolFrac ) const
+  computeImbibitionWettingScanningCurve( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
+                                         real64 const & jerauldParam_a,
+                                         real64 const & jerauldParam_b,
+                                         real64 const & landParam,
+                                         real64 const & phaseMinHistoricalVolFraction,
+                                         real64 const & imbibitionPhaseMinWettingVolFraction,
+                                         real64 const & drainagePhaseMaxVolFraction,
+                                         real64 const & imbibitionPhaseMaxVolFraction,
+                                         real64 const & imbibitionRelPermEndPoint,
+                                         arraySlice1d< real64 > const & scanningCurveParams ) const
 {
+  using SCP = TableRelativePermeabilityHysteresis::ScanningCurveParamType;
 
   // Step 0: preparing keypoints in the (S,kr) plan
   // if consistent, S should be equal to 1 - imbibitionPhaseMinVolNonWettingFraction for two-phase flow
   // (but wetting and nonwetting phase hysteresis are implemented in a decoupled fashion)
-  real64 const S = phaseVolFraction;
   real64 const Smxi = imbibitionPhaseMaxVolFraction;
   real64 const Smxd = drainagePhaseMaxVolFraction;
 
   // Swc is the common end min endpoint saturation for wetting curves
   real64 const Swc = imbibitionPhaseMinWettingVolFraction;
+  real64 const Shy = ( phaseMinHistoricalVolFraction > Swc ) ? phaseMinHistoricalVolFraction : Swc;
 
-  if( S <= Swc )
+  // There is no scanning curve if the wetting phase has never been drained below its max drainage volume fraction
+  // (e.g., brine-saturated cell), and the trapped saturation below is undefined: the drainage relperm is used instead
+  if( !( Shy < Smxd ) )
   {
-    phaseRelPerm = 0.0;
-    dPhaseRelPerm_dPhaseVolFrac = 0.0;
-  }
-  else if( S >= Smxd )
-  {
-    phaseRelPerm = drainageRelPermEndPoint;
-    dPhaseRelPerm_dPhaseVolFrac = 0.0;
+    for( integer ip = 0; ip < SCP::NUM_PARAMS; ++ip )
+    {
+      scanningCurveParams[ip] = 0.0;
+    }
+    return;
   }
-  else
-  {
-    real64 const krwei = imbibitionRelPermEndPoint;
-    real64 const krwedAtSmxi = drainageRelPermKernelWrapper.compute( &Smxi );
-
-    // Step 1: Compute the new end point
-
-    // Step 1.a: get the value at the max non-wetting residual value
-    real64 const deltak = krwei - krwedAtSmxi;
-
-    // Step 1.b: get the trapped from wetting data
-    real64 const Shy = ( phaseMinHistoricalVolFraction > Swc ) ? phaseMinHistoricalVolFraction : Swc;
-    real64 const A = 1 + jerauldParam_a * ( Shy - Swc );
-    real64 const numerator = Shy - Smxd;
-    real64 const denom = A + landParam * pow( ( Smxd - Shy ) / ( Smxd - Swc ), 1 + jerauldParam_b/landParam );
-    real64 const Scrt = Smxd + numerator / denom;
-
-    // Step 1.c: find the new endpoint
-    // this is the saturation for the scanning curve endpoint
-    real64 const krwedAtScrt = drainageRelPermKernelWrapper.compute( &Scrt );
-    real64 const krwieStar = krwedAtScrt
-                             + deltak * pow( ( Smxd - Scrt ) / LvArray::math::max( minScriMinusScrd, ( Smxd - Smxi ) ), m_killoughCurvatureParam );
-
-    // Step 2: get the normalized value of saturation
-    real64 const ratio = ( Smxi - Swc ) / ( Scrt - Shy );
-    real64 const Snorm = Smxi - ( Scrt - S ) * ratio; // normalized saturation from equation 2.166
-    real64 const dSnorm_dS =  ratio;
-    real64 dkri_dSnorm = 0.0;
-    real64 const krwiAtSnorm = imbibitionRelPermKernelWrapper.compute( &Snorm, &dkri_dSnorm );
-    real64 const dkriAtSnorm_dS = dkri_dSnorm * dSnorm_dS;
 
-    // Step 3: Get the final value at evaluated saturation
-    real64 const krdAtShy = drainageRelPermKernelWrapper.compute( &Shy );
-    real64 const imbibitionRelPermRatio = (krwieStar - krdAtShy) / krwei;
+  real64 const krwei = imbibitionRelPermEndPoint;
+  real64 const krwedAtSmxi = drainageRelPermKernelWrapper.compute( &Smxi );
 
-    phaseRelPerm = krdAtShy + krwiAtSnorm * imbibitionRelPermRatio;
-    dPhaseRelPerm_dPhaseVolFrac = dkriAtSnorm_dS * imbibitionRelPermRatio;
-  }
+  // Step 1: Compute the new end point
+
+  // Step 1.a: get the value at the max non-wetting residual value
+  real64 const deltak = krwei - krwedAtSmxi;
+
+  // Step 1.b: get the trapped from wetting data
+  real64 const A = 1 + jerauldParam_a * ( Shy - Swc );
+  real64 const numerator = Shy - Smxd;
+  real64 const denom = A + landParam * pow( ( Smxd - Shy ) / ( Smxd - Swc ), 1 + jerauldParam_b/landParam );
+  real64 const Scrt = Smxd + numerator / denom;
+
+  // Step 1.c: find the new endpoint
+  // this is the saturation for the scanning curve endpoint
+  real64 const krwedAtScrt = drainageRelPermKernelWrapper.compute( &Scrt );
+  real64 const krwieStar = krwedAtScrt
+                           + deltak * pow( ( Smxd - Scrt ) / LvArray::math::max( minScriMinusScrd, ( Smxd - Smxi ) ), m_killoughCurvatureParam );
+
+  // Step 2: get the normalized value of saturation, Snorm = Smxi - ( Scrt - S ) * ratio (equation 2.166)
+  real64 const ratio = ( Smxi - Swc ) / ( Scrt - Shy );
+
+  // Step 3: get the drainage value at the historical saturation to blend it with the imbibition value
+  real64 const krdAtShy = drainageRelPermKernelWrapper.compute( &Shy );
+
+  scanningCurveParams[SCP::MIN_VOL_FRACTION] = Swc;
+  scanningCurveParams[SCP::SNORM_INTERCEPT] = Smxi - Scrt * ratio;
+  scanningCurveParams[SCP::SNORM_SLOPE] = ratio;
+  scanningCurveParams[SCP::REL_PERM_OFFSET] = krdAtShy;
+  scanningCurveParams[SCP::REL_PERM_SCALE] = ( krwieStar - krdAtShy ) / krwei;
 }
 
 GEOSX_HOST_DEVICE
 inline void
 TableRelativePermeabilityHysteresis::KernelWrapper::
-  computeImbibitionNonWettingRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
-                                      TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
-                                      real64 const & jerauldParam_a,
-                                      real64 const & jerauldParam_b,
-                                      real64 const & landParam,
-                                      real64 const & phaseVolFraction,
-                                      real64 const & phaseMaxHistoricalVolFraction,
-                                      real64 const & drainagePhaseMinVolFraction,
-                                      real64 const & imbibitionPhaseMinVolFraction,
-                                      real64 const & drainagePhaseMaxVolFraction,
-                                      real64 const & drainageRelPermEndPoint,
-                                      real64 & phaseRelPerm,
-                                      real64 & dPhaseRelPerm_dPhaseVolFrac ) const
+  computeImbibitionNonWettingScanningCurve( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
+                                            real64 const & jerauldParam_a,
+                                            real64 const & jerauldParam_b,
+                                            real64 const & landParam,
+                                            real64 const & phaseMaxHistoricalVolFraction,
+                                            real64 const & drainagePhaseMinVolFraction,
+                                            real64 const & imbibitionPhaseMinVolFraction,
+                                            real64 const & drainagePhaseMaxVolFraction,
+                                            real64 const & drainageRelPermEndPoint,
+                                            arraySlice1d< real64 > const & scanningCurveParams ) const
 {
+  using SCP = TableRelativePermeabilityHysteresis::ScanningCurveParamType;
+
   // note: for simplicity, the notations are taken from IX documentation (although this breaks our phaseVolFrac naming convention)
 
   // Step 1: for a given value of the max historical saturation, Shy, compute the trapped critical saturation, Scrt,
   //         using Land's method. The calculation includes the modifications from Jerauld. This is equation 2.162 from
   //         the IX technical description.
-  real64 const S = phaseVolFraction;
   real64 const Scri = imbibitionPhaseMinVolFraction;
   real64 const Scrd = drainagePhaseMinVolFraction;
   real64 const Smx = drainagePhaseMaxVolFraction;
   real64 const Shy = phaseMaxHistoricalVolFraction < Smx ? phaseMaxHistoricalVolFraction : Smx; // to make sure that Shy < Smax
+
+  // There is no scanning curve if the non-wetting phase has never exceeded its critical drainage volume fraction
+  // (e.g., gas-free cell), and the trapped saturation below is undefined: the drainage relperm is used instead
+  if( !( Shy > Scrd ) )
+  {
+    for( integer ip = 0; ip < SCP::NUM_PARAMS; ++ip )
+    {
+      scanningCurveParams[ip] = 0.0;
+    }
+    return;
+  }
+
   real64 const A = 1 + jerauldParam_a * ( Smx - Shy );
   real64 const numerator = Shy - Scrd;
   real64 const denom = A + landParam * pow( ( Shy - Scrd ) / ( Smx - Scrd ), 1 + jerauldParam_b / landParam );
   real64 const Scrt = Scrd + numerator / denom; // trapped critical saturation from equation 2.162
 
-  if( S <= Scrt )  // S is below the trapped critical saturation, so the relperm is zero
+  // Step 2: compute the normalized saturation, Snorm = Scri + ( S - Scrt ) * ratio, at which the imbibition relperm
+  //         curve will be evaluated. This is equation 2.166 from the IX technical description.
+  real64 const ratio = ( Smx - Scri ) / ( Shy - Scrt );
+
+  // Step 3: evaluate the drainage relperm, krd(Shy), at the max hystorical saturation, Shy.
+  real64 const krdAtShy = drainageRelPermKernelWrapper.compute( &Shy );
+
+  // Step 4: evaluate the drainage relperm, krd(Smx), at the max drainage saturation, Smx.
+  real64 const krdAtSmx = drainageRelPermEndPoint;
+
+  // Step 5: the ratio blending drainage and imbibition relperms from the Killough model (equation 2.165)
+  scanningCurveParams[SCP::MIN_VOL_FRACTION] = Scrt;
+  scanningCurveParams[SCP::SNORM_INTERCEPT] = Scri - Scrt * ratio;
+  scanningCurveParams[SCP::SNORM_SLOPE] = ratio;
+  scanningCurveParams[SCP::REL_PERM_OFFSET] = 0.0;
+  scanningCurveParams[SCP::REL_PERM_SCALE] = krdAtShy / krdAtSmx;
+}
+
+GEOSX_HOST_DEVICE
+inline void
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  computeScanningCurves( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
+                         arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                         arraySlice2d< real64 > const & scanningCurveParams ) const
+{
+  using PT = RelativePermeabilityBase::PhaseType;
+  using IPT = TableRelativePermeabilityHysteresis::ImbibitionPhasePairPhaseType;
+
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil   = m_phaseOrder[PT::OIL];
+  integer const ipGas   = m_phaseOrder[PT::GAS];
+
+  // same choice of wetting and non-wetting phases as in compute
+  bool const isThreePhase = ( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 );
+  integer const ipWetting = ( ipWater >= 0 ) ? ipWater : ipOil;
+  integer const ipNonWetting = ( ipGas >= 0 ) ? ipGas : ipOil;
+  integer const drainageWetting = isThreePhase
+    ? integer( ThreePhasePairPhaseType::WETTING )
+    : integer( TwoPhasePairPhaseType::WETTING );
+  integer const drainageNonWetting = isThreePhase
+    ? integer( ThreePhasePairPhaseType::NONWETTING )
+    : integer( TwoPhasePairPhaseType::NONWETTING );
+
+  if( m_phaseHasHysteresis[IPT::WETTING] )
+  {
+    computeImbibitionWettingScanningCurve( m_drainageRelPermKernelWrappers[drainageWetting],
+                                           m_jerauldParam_a,
+                                           m_jerauldParam_b,
+                                           m_landParam[IPT::WETTING],
+                                           phaseMinHistoricalVolFraction[ipWetting],
+                                           m_imbibitionPhaseMinVolFraction[IPT::WETTING],
+                                           m_drainagePhaseMaxVolFraction[ipWetting],
+                                           m_imbibitionPhaseMaxVolFraction[IPT::WETTING],
+                                           m_imbibitionPhaseRelPermEndPoint[IPT::WETTING],
+                                           scanningCurveParams[IPT::WETTING] );
+  }
+
+  if( m_phaseHasHysteresis[IPT::NONWETTING] )
+  {
+    computeImbibitionNonWettingScanningCurve( m_drainageRelPermKernelWrappers[drainageNonWetting],
+                                              m_jerauldParam_a,
+                                              m_jerauldParam_b,
+                                              m_landParam[IPT::NONWETTING],
+                                              phaseMaxHistoricalVolFraction[ipNonWetting],
+                                              m_drainagePhaseMinVolFraction[ipNonWetting],
+                                              m_imbibitionPhaseMinVolFraction[IPT::NONWETTING],
+                                              m_drainagePhaseMaxVolFraction[ipNonWetting],
+                                              m_drainagePhaseRelPermEndPoint[ipNonWetting],
+                                              scanningCurveParams[IPT::NONWETTING] );
+  }
+}
+
+GEOSX_HOST_DEVICE
+inline void
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  computeImbibitionRelPerm( TableFunction::KernelWrapper const & imbibitionRelPermKernelWrapper,
+                            arraySlice1d< real64 const > const & scanningCurveParams,
+                            real64 const & drainagePhaseMaxVolFraction,
+                            real64 const & drainageRelPermEndPoint,
+                            real64 const & phaseVolFraction,
+                            real64 & phaseRelPerm,
+                            real64 & dPhaseRelPerm_dPhaseVolFrac ) const
+{
+  using SCP = TableRelativePermeabilityHysteresis::ScanningCurveParamType;
+
+  real64 const S = phaseVolFraction;
+
+  if( S <= scanningCurveParams[SCP::MIN_VOL_FRACTION] ) // S is below the trapped (or connate) saturation, so the relperm is zero
   {
     phaseRelPerm = 0.0;
     dPhaseRelPerm_dPhaseVolFrac = 0.0;
   }
-  else if( S >= Smx ) // S is above the max saturation, so we just skip the rest and set the relperm to the endpoint
+  else if( S >= drainagePhaseMaxVolFraction ) // S is above the max saturation, so we just set the relperm to the endpoint
   {
     phaseRelPerm = drainageRelPermEndPoint;
     dPhaseRelPerm_dPhaseVolFrac = 0.0;
   }
   else
   {
-    // Step 2: compute the normalized saturation, S_norm, at which the imbibition relperm curve will be evaluated.
-    //         This is equation 2.166 from the IX technical description.
-    real64 const ratio = ( Smx - Scri ) / ( Shy - Scrt );
-    real64 const Snorm = Scri + ( S - Scrt ) * ratio; // normalized saturation from equation 2.166
-    real64 const dSnorm_dS = ratio;
-
-    // Step 3: evaluate the imbibition relperm, kri(Snorm), at the normalized saturation, Snorm.
-    real64 dkri_dSnorm = 0;
+    // only one table lookup per phase is left here, everything else comes from the precomputed scanning curve
+    real64 const dSnorm_dS = scanningCurveParams[SCP::SNORM_SLOPE];
+    real64 const Snorm = scanningCurveParams[SCP::SNORM_INTERCEPT] + S * dSnorm_dS;
+    real64 dkri_dSnorm = 0.0;
     real64 const kriAtSnorm = imbibitionRelPermKernelWrapper.compute( &Snorm, &dkri_dSnorm );
-    real64 const dkriAtSnorm_dS = dkri_dSnorm * dSnorm_dS;
-
-    // Step 4: evaluate the drainage relperm, krd(Shy), at the max hystorical saturation, Shy.
-    real64 const krdAtShy = drainageRelPermKernelWrapper.compute( &Shy );
 
-    // Step 5: evaluate the drainage relperm, krd(Smx), at the max drainage saturation, Smx.
-    real64 const krdAtSmx = drainageRelPermEndPoint;
-
-    // Step 6: apply the formula blending drainage and imbibition relperms from the Killough model.
-    //         This equation 2.165 from the IX technical description.
-    real64 const drainageRelPermRatio = krdAtShy / krdAtSmx;
-    phaseRelPerm = kriAtSnorm * drainageRelPermRatio;
-    dPhaseRelPerm_dPhaseVolFrac = dkriAtSnorm_dS * drainageRelPermRatio;
+    real64 const scale = scanningCurveParams[SCP::REL_PERM_SCALE];
+    phaseRelPerm = scanningCurveParams[SCP::REL_PERM_OFFSET] + kriAtSnorm * scale;
+    dPhaseRelPerm_dPhaseVolFrac = dkri_dSnorm * dSnorm_dS * scale;
   }
 }
 
@@ -652,6 +804,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
                    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                   arraySlice2d< real64 const > const & scanningCurveParams,
                    arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                    arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
 {
@@ -660,7 +813,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
 
   // ---------- wetting rel perm
   if( !m_phaseHasHysteresis[IPT::WETTING] ||
-      phaseVolFraction[ipWetting] <= phaseMinHistoricalVolFraction[ipWetting] + flowReversalBuffer )
+      phaseVolFraction[ipWetting] <= phaseMinHistoricalVolFraction[ipWetting] + flowReversalBuffer ||
+      !hasScanningCurve( scanningCurveParams[IPT::WETTING] ) )
   {
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
                             phaseVolFraction[ipWetting],
@@ -669,25 +823,19 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   }
   else
   {
-    computeImbibitionWettingRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
-                                     m_imbibitionRelPermKernelWrappers[IPT::WETTING],
-                                     m_jerauldParam_a,
-                                     m_jerauldParam_b,
-                                     m_landParam[IPT::WETTING],
-                                     phaseVolFraction[ipWetting],
-                                     phaseMinHistoricalVolFraction[ipWetting],
-                                     m_imbibitionPhaseMinVolFraction[IPT::WETTING],
-                                     m_drainagePhaseMaxVolFraction[ipWetting],
-                                     m_imbibitionPhaseMaxVolFraction[IPT::WETTING],
-                                     m_drainagePhaseRelPermEndPoint[ipWetting],
-                                     m_imbibitionPhaseRelPermEndPoint[IPT::WETTING],
-                                     phaseRelPerm[ipWetting],
-                                     dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
+    computeImbibitionRelPerm( m_imbibitionRelPermKernelWrappers[IPT::WETTING],
+                              scanningCurveParams[IPT::WETTING],
+                              m_drainagePhaseMaxVolFraction[ipWetting],
+                              m_drainagePhaseRelPermEndPoint[ipWetting],
+                              phaseVolFraction[ipWetting],
+                              phaseRelPerm[ipWetting],
+                              dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
   }
 
   // --------- non-wetting rel perm
   if( !m_phaseHasHysteresis[IPT::NONWETTING] ||
-      phaseVolFraction[ipNonWetting] >= phaseMaxHistoricalVolFraction[ipNonWetting] - flowReversalBuffer )
+      phaseVolFraction[ipNonWetting] >= phaseMaxHistoricalVolFraction[ipNonWetting] - flowReversalBuffer ||
+      !hasScanningCurve( scanningCurveParams[IPT::NONWETTING] ) )
   {
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
                             phaseVolFraction[ipNonWetting],
@@ -696,19 +844,13 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   }
   else
   {
-    computeImbibitionNonWettingRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
-                                        m_imbibitionRelPermKernelWrappers[IPT::NONWETTING],
-                                        m_jerauldParam_a,
-                                        m_jerauldParam_b,
-                                        m_landParam[IPT::NONWETTING],
-                                        phaseVolFraction[ipNonWetting],
-                                        phaseMaxHistoricalVolFraction[ipNonWetting],
-                                        m_drainagePhaseMinVolFraction[ipNonWetting],
-                                        m_imbibitionPhaseMinVolFraction[IPT::NONWETTING],
-                                        m_drainagePhaseMaxVolFraction[ipNonWetting],
-                                        m_drainagePhaseRelPermEndPoint[ipNonWetting],
-                                        phaseRelPerm[ipNonWetting],
-                                        dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
+    computeImbibitionRelPerm( m_imbibitionRelPermKernelWrappers[IPT::NONWETTING],
+                              scanningCurveParams[IPT::NONWETTING],
+                              m_drainagePhaseMaxVolFraction[ipNonWetting],
+                              m_drainagePhaseRelPermEndPoint[ipNonWetting],
+                              phaseVolFraction[ipNonWetting],
+                              phaseRelPerm[ipNonWetting],
+                              dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
   }
 }
 
@@ -721,6 +863,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                      arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
                      arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+                     arraySlice2d< real64 const > const & scanningCurveParams,
                      arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                      arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
 {
@@ -736,7 +879,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
 
   // ---------- wetting rel perm
   if( !m_phaseHasHysteresis[IPT::WETTING] ||
-      phaseVolFraction[ipWetting] <= phaseMinHistoricalVolFraction[ipWetting] + flowReversalBuffer )
+      phaseVolFraction[ipWetting] <= phaseMinHistoricalVolFraction[ipWetting] + flowReversalBuffer ||
+      !hasScanningCurve( scanningCurveParams[IPT::WETTING] ) )
   {
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
                             phaseVolFraction[ipWetting],
@@ -745,20 +889,13 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   }
   else
   {
-    computeImbibitionWettingRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
-                                     m_imbibitionRelPermKernelWrappers[IPT::WETTING],
-                                     m_jerauldParam_a,
-                                     m_jerauldParam_b,
-                                     m_landParam[IPT::WETTING],
-                                     phaseVolFraction[ipWetting],
-                                     phaseMinHistoricalVolFraction[ipWetting],
-                                     m_imbibitionPhaseMinVolFraction[IPT::WETTING],
-                                     m_drainagePhaseMaxVolFraction[ipWetting],
-                                     m_imbibitionPhaseMaxVolFraction[IPT::WETTING],
-                                     m_drainagePhaseRelPermEndPoint[ipWetting],
-                                     m_imbibitionPhaseRelPermEndPoint[IPT::WETTING],
-                                     phaseRelPerm[ipWetting],
-                                     dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
+    computeImbibitionRelPerm( m_imbibitionRelPermKernelWrappers[IPT::WETTING],
+                              scanningCurveParams[IPT::WETTING],
+                              m_drainagePhaseMaxVolFraction[ipWetting],
+                              m_drainagePhaseRelPermEndPoint[ipWetting],
+                              phaseVolFraction[ipWetting],
+                              phaseRelPerm[ipWetting],
+                              dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
   }
 
   // ---------- intermediate rel perm (ALWAYS DRAINAGE!)
@@ -771,7 +908,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
 
   // ---------- non-wetting rel perm
   if( !m_phaseHasHysteresis[IPT::NONWETTING] ||
-      phaseVolFraction[ipNonWetting] >= phaseMaxHistoricalVolFraction[ipNonWetting] - flowReversalBuffer )
+      phaseVolFraction[ipNonWetting] >= phaseMaxHistoricalVolFraction[ipNonWetting] - flowReversalBuffer ||
+      !hasScanningCurve( scanningCurveParams[IPT::NONWETTING] ) )
   {
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
                             phaseVolFraction[ipNonWetting],
@@ -780,19 +918,13 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   }
   else
   {
-    computeImbibitionNonWettingRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
-                                        m_imbibitionRelPermKernelWrappers[IPT::NONWETTING],
-                                        m_jerauldParam_a,
-                                        m_jerauldParam_b,
-                                        m_landParam[IPT::NONWETTING],
-                                        phaseVolFraction[ipNonWetting],
-                                        phaseMaxHistoricalVolFraction[ipNonWetting],
-                                        m_drainagePhaseMinVolFraction[ipNonWetting],
-                                        m_imbibitionPhaseMinVolFraction[IPT::NONWETTING],
-                                        m_drainagePhaseMaxVolFraction[ipNonWetting],
-                                        m_drainagePhaseRelPermEndPoint[ipNonWetting],
-                                        phaseRelPerm[ipNonWetting],
-                                        dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
+    computeImbibitionRelPerm( m_imbibitionRelPermKernelWrappers[IPT::NONWETTING],
+                              scanningCurveParams[IPT::NONWETTING],
+                              m_drainagePhaseMaxVolFraction[ipNonWetting],
+                              m_drainagePhaseRelPermEndPoint[ipNonWetting],
+                              phaseVolFraction[ipNonWetting],
+                              phaseRelPerm[ipNonWetting],
+                              dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
   }
 
   // ---------- intermediate rel perm (ALWAYS DRAINAGE!)
@@ -822,6 +954,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMaxHistoricalVolFraction,
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
+           arraySlice2d< real64 const > const & scanningCurveParams,
            arraySlice1d< real64, relperm::USD_RELPERM - 2 > const & phaseRelPerm,
            arraySlice2d< real64, relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
 {
@@ -840,6 +973,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                        phaseVolFraction,
                        phaseMaxHistoricalVolFraction,
                        phaseMinHistoricalVolFraction,
+                       scanningCurveParams,
                        phaseRelPerm,
                        dPhaseRelPerm_dPhaseVolFrac );
 
@@ -851,6 +985,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseVolFraction,
                      phaseMaxHistoricalVolFraction,
                      phaseMinHistoricalVolFraction,
+                     scanningCurveParams,
                      phaseRelPerm,
                      dPhaseRelPerm_dPhaseVolFrac );
   }
@@ -861,6 +996,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseVolFraction,
                      phaseMaxHistoricalVolFraction,
                      phaseMinHistoricalVolFraction,
+                     scanningCurveParams,
                      phaseRelPerm,
                      dPhaseRelPerm_dPhaseVolFrac );
   }
@@ -871,6 +1007,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseVolFraction,
                      phaseMaxHistoricalVolFraction,
                      phaseMinHistoricalVolFraction,
+                     scanningCurveParams,
                      phaseRelPerm,
                      dPhaseRelPerm_dPhaseVolFrac );
   }
@@ -886,6 +1023,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
   compute( phaseVolFraction,
            m_phaseMaxHistoricalVolFraction[k],
            m_phaseMinHistoricalVolFraction[k],
+           m_scanningCurveParams[k],
            m_phaseRelPerm[k][q],
            m_dPhaseRelPerm_dPhaseVolFrac[k][q] );
 }
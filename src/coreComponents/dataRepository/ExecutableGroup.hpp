@@ -96,6 +96,15 @@ public:
     return 1e99;
   }
 
+  /**
+   * @brief Tell whether the timestep requests of this target are identical on all the ranks.
+   * @return true if getTimestepRequest() only depends on globally reduced quantities
+   * @note The targets overriding getTimestepRequest() with a request computed from rank-local data must return false,
+   *       otherwise the event manager may skip the reduction of the cycle dt across the ranks.
+   */
+  virtual bool hasGloballyConsistentTimestepRequest() const
+  { return true; }
+
 
   /**
    * @brief Set the timestep behavior for a target.
@@ -16,17 +16,68 @@
 #include "Group.hpp"
 #include "ConduitRestart.hpp"
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/Format.hpp"
+#include "common/MpiWrapper.hpp"
 #include "common/TimingMacros.hpp"
+#include "LvArray/src/system.hpp"
 
 #if defined(GEOSX_USE_PYGEOSX)
 #include "python/PyGroupType.hpp"
 #endif
 
+#include <unordered_map>
+
 namespace geosx
 {
 namespace dataRepository
 {
 
+namespace
+{
+
+/**
+ * @brief List the wrappers and the sub-groups of a group in depth-first order, along with their allocated bytes.
+ * @param[in] group the group to list (not listed itself)
+ * @param[in] path the path of @p group, ending with '/'
+ * @param[in] depth the depth of the children of @p group
+ * @param[inout] paths the paths of the listed entries (the paths of the groups end with '/')
+ * @param[inout] depths the depths of the listed entries
+ * @param[inout] bytes the number of bytes allocated by the listed entries
+ * @return the number of bytes allocated by @p group
+ */
+localIndex flattenMemoryTree( Group const & group,
+                              string const & path,
+                              integer const depth,
+                              std::vector< string > & paths,
+                              std::vector< integer > & depths,
+                              std::vector< real64 > & bytes )
+{
+  localIndex groupBytes = 0;
+  group.forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    localIndex const wrapperBytes = wrapper.bytesAllocated();
+    paths.emplace_back( path + wrapper.getName() );
+    depths.emplace_back( depth );
+    bytes.emplace_back( wrapperBytes );
+    groupBytes += wrapperBytes;
+  } );
+
+  group.forSubGroups( [&]( Group const & subGroup )
+  {
+    std::size_t const index = paths.size();
+    paths.emplace_back( path + subGroup.getName() + '/' );
+    depths.emplace_back( depth );
+    bytes.emplace_back( 0.0 );
+    localIndex const subGroupBytes = flattenMemoryTree( subGroup, paths[index], depth + 1, paths, depths, bytes );
+    bytes[index] = subGroupBytes;
+    groupBytes += subGroupBytes;
+  } );
+
+  return groupBytes;
+}
+
+}
+
 Group::Group( string const & name,
               Group * const parent ):
   Group( name, parent->getConduitNode() )
@@ -243,6 +294,128 @@ void Group::printDataHierarchy( integer const indent )
   }
 }
 
+void Group::getDeferredAllocations( std::map< string, localIndex > & deferredBytes ) const
+{
+  forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    if( wrapper.isLazyAllocation() )
+    {
+      deferredBytes[ wrapper.getName() ] += wrapper.deferredByteSize();
+    }
+  } );
+
+  forSubGroups( [&]( Group const & subGroup )
+  {
+    subGroup.getDeferredAllocations( deferredBytes );
+  } );
+}
+
+localIndex Group::bytesAllocated() const
+{
+  localIndex groupBytes = 0;
+  forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    groupBytes += wrapper.bytesAllocated();
+  } );
+
+  forSubGroups( [&]( Group const & subGroup )
+  {
+    groupBytes += subGroup.bytesAllocated();
+  } );
+
+  return groupBytes;
+}
+
+void Group::printMemoryAllocation( localIndex const threshold, bool const aggregate ) const
+{
+  std::vector< string > paths( 1, "/" );
+  std::vector< integer > depths( 1, 0 );
+  std::vector< real64 > bytes( 1, 0.0 );
+  bytes[0] = flattenMemoryTree( *this, paths[0], 1, paths, depths, bytes );
+
+  int numRanks = 1;
+  std::vector< real64 > minBytes = bytes;
+  std::vector< real64 > maxBytes = bytes;
+  std::vector< real64 > sumBytes = bytes;
+  if( aggregate )
+  {
+    // the entries of rank 0 are reported, the other ranks contribute the allocations of their entries with the same path
+    int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+    string reportedPaths;
+    if( rank == 0 )
+    {
+      for( string const & path : paths )
+      {
+        reportedPaths += path + '\n';
+      }
+    }
+    MpiWrapper::broadcast( reportedPaths, 0, MPI_COMM_GEOSX );
+
+    std::unordered_map< string, real64 > localBytes;
+    for( std::size_t i = 0; i < paths.size(); ++i )
+    {
+      localBytes.emplace( paths[i], bytes[i] );
+    }
+
+    minBytes.clear();
+    for( std::size_t first = 0, last = reportedPaths.find( '\n' ); last != string::npos; first = last + 1, last = reportedPaths.find( '\n', first ) )
+    {
+      auto const it = localBytes.find( reportedPaths.substr( first, last - first ) );
+      minBytes.emplace_back( it != localBytes.end() ? it->second : 0.0 );
+    }
+    maxBytes = minBytes;
+    sumBytes = minBytes;
+
+    int const numReported = LvArray::integerConversion< int >( minBytes.size() );
+    MpiWrapper::allReduce( minBytes.data(), minBytes.data(), numReported, MPI_MIN, MPI_COMM_GEOSX );
+    MpiWrapper::allReduce( maxBytes.data(), maxBytes.data(), numReported, MPI_MAX, MPI_COMM_GEOSX );
+    MpiWrapper::allReduce( sumBytes.data(), sumBytes.data(), numReported, MPI_SUM, MPI_COMM_GEOSX );
+
+    if( rank != 0 )
+    {
+      return;
+    }
+    numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  }
+
+  // name of each entry, indented by its depth
+  std::vector< string > names( paths.size() );
+  std::size_t nameWidth = 5;
+  for( std::size_t i = 0; i < paths.size(); ++i )
+  {
+    string const & path = paths[i];
+    std::size_t const end = path.back() == '/' ? path.size() - 1 : path.size();
+    std::size_t const begin = path.rfind( '/', end - 1 ) + 1;
+    string const name = i == 0 ? getName() + '/' : path.substr( begin );
+    names[i] = string( LvArray::integerConversion< std::size_t >( 2 * depths[i] ), ' ' ) + name;
+    nameWidth = std::max( nameWidth, names[i].size() );
+  }
+
+  std::ostringstream report;
+  report << GEOSX_FMT( "\nMemory allocations ({} rank(s), entries below {} on every rank not shown):\n",
+                       numRanks, LvArray::system::calculateSize( LvArray::integerConversion< std::size_t >( threshold ) ) );
+  report << GEOSX_FMT( "{:<{}}  {:>12}  {:>12}  {:>12}\n", "Entry", nameWidth, "Min", "Avg", "Max" );
+  for( std::size_t i = 0; i < paths.size(); ++i )
+  {
+    if( maxBytes[i] >= threshold )
+    {
+      report << GEOSX_FMT( "{:<{}}  {:>12}  {:>12}  {:>12}\n", names[i], nameWidth,
+                           LvArray::system::calculateSize( static_cast< std::size_t >( minBytes[i] ) ),
+                           LvArray::system::calculateSize( static_cast< std::size_t >( sumBytes[i] / numRanks ) ),
+                           LvArray::system::calculateSize( static_cast< std::size_t >( maxBytes[i] ) ) );
+    }
+  }
+
+  if( aggregate )
+  {
+    GEOSX_LOG_RANK_0( report.str() );
+  }
+  else
+  {
+    GEOSX_LOG_RANK( report.str() );
+  }
+}
+
 string Group::dumpInputOptions() const
 {
   string rval;
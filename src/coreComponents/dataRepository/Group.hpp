@@ -29,6 +29,7 @@
 
 
 #include <iostream>
+#include <map>
 
 #ifndef NOCHARTOSTRING_KEYLOOKUP
 /// macro definition to enable/disable char * lookups
@@ -160,6 +161,26 @@ public:
    */
   void printDataHierarchy( integer indent = 0 );
 
+  /**
+   * @brief Accumulate the storage deferred by the lazily allocated wrappers of this group and of its sub-groups.
+   * @param[inout] deferredBytes the number of bytes that are not allocated, keyed by the name of the lazily
+   *                             allocated wrappers (wrappers that were allocated contribute 0 bytes)
+   */
+  void getDeferredAllocations( std::map< string, localIndex > & deferredBytes ) const;
+
+  /**
+   * @brief @return the number of bytes allocated by the wrappers of this group and of its sub-groups.
+   */
+  localIndex bytesAllocated() const;
+
+  /**
+   * @brief Print the memory allocated by the wrappers of this group and of its sub-groups, as a tree.
+   * @param[in] threshold the entries allocating less than @p threshold bytes on every rank are not printed
+   * @param[in] aggregate if true the allocations of all the ranks are aggregated and printed by rank 0,
+   *                      which is collective over MPI_COMM_GEOSX, else this rank prints its own allocations
+   */
+  void printMemoryAllocation( localIndex threshold = 1024 * 1024, bool aggregate = true ) const;
+
   /**
    * @brief @return a table formatted string containing all input options.
    */
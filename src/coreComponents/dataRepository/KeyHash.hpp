@@ -0,0 +1,134 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KeyHash.hpp
+ */
+
+#ifndef GEOSX_DATAREPOSITORY_KEYHASH_HPP_
+#define GEOSX_DATAREPOSITORY_KEYHASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace geosx
+{
+namespace dataRepository
+{
+
+/// Type of the hash of a MappedVector key
+using KeyHashType = std::uint64_t;
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a key.
+ * @param[in] key the characters of the key
+ * @param[in] length the number of characters of the key
+ * @return the hash of the key
+ * @note Being constexpr, the hash of a constant key (e.g. a viewKeyStruct string) can be computed at compile time.
+ */
+constexpr KeyHashType keyHash( char const * const key, std::size_t const length )
+{
+  KeyHashType hash = 14695981039346656037ULL;
+  for( std::size_t i = 0; i < length; ++i )
+  {
+    hash ^= static_cast< unsigned char >( key[i] );
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a null-terminated key.
+ * @param[in] key the key
+ * @return the hash of the key
+ */
+constexpr KeyHashType keyHash( char const * const key )
+{
+  std::size_t length = 0;
+  while( key[length] != '\0' )
+  {
+    ++length;
+  }
+  return keyHash( key, length );
+}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a key.
+ * @param[in] key the key
+ * @return the hash of the key
+ */
+inline KeyHashType keyHash( std::string const & key )
+{
+  return keyHash( key.data(), key.size() );
+}
+
+/**
+ * @struct HashedKey
+ * @brief A null-terminated key along with its hash, to perform MappedVector lookups without hashing the key.
+ *
+ * When constructed in a constant expression from a constant key (e.g. a viewKeyStruct string),
+ * the hash is computed at compile time.
+ */
+struct HashedKey
+{
+  /**
+   * @brief Constructor.
+   * @param[in] k the key, must outlive the HashedKey
+   */
+  constexpr explicit HashedKey( char const * const k ):
+    key( k ),
+    hash( keyHash( k ) )
+  {}
+
+  /// The key
+  char const * key;
+
+  /// The hash of the key
+  KeyHashType hash;
+};
+
+/**
+ * @brief Get the HashedKey of a constant key returned by a constexpr function, hashed at compile time.
+ * @tparam KEY the constexpr function returning the key, typically a viewKeyStruct accessor
+ * @return the hashed key
+ * @details A lookup with the string returned by a viewKeyStruct accessor hashes the key at runtime,
+ * while a lookup with this HashedKey only compares the keys sharing its hash, e.g.:
+ * @code
+ *   group.getReference< string >( hashedKey< viewKeyStruct::fluidNamesString >() );
+ * @endcode
+ */
+template< char const * ( *KEY )() >
+HashedKey const & hashedKey()
+{
+  static constexpr HashedKey key( KEY() );
+  return key;
+}
+
+/**
+ * @brief Print a HashedKey to an output stream.
+ * @param os the stream
+ * @param hashedKey the key to output
+ * @return a reference to the stream @p os
+ */
+inline std::ostream & operator<<( std::ostream & os, HashedKey const & hashedKey )
+{
+  return os << hashedKey.key;
+}
+
+} // namespace dataRepository
+} // namespace geosx
+
+#endif /* GEOSX_DATAREPOSITORY_KEYHASH_HPP_ */
@@ -20,6 +20,8 @@
 #define GEOSX_DATAREPOSITORY_KEYINDEXT_HPP_
 
 
+#include "KeyHash.hpp"
+
 #include <ostream>
 
 /**
@@ -32,7 +34,8 @@
  * is templated on a contains a KEY_TYPE, which is defaulted to a string, an
  * INDEX_TYPE that defaults to an int. The key is const, while the index is set
  * upon first use. The intent is to use the index for lookups, and check the
- * key to confirm the key is correct.
+ * key to confirm the key is correct. The hash of the key is computed once at
+ * construction, so that resolving the index never hashes the key again.
  */
 template< typename KEY_TYPE = std::string,
           typename INDEX_TYPE = int,
@@ -60,6 +63,7 @@ public:
    */
   KeyIndexT( KEY_TYPE const & key ):
     m_key( key ),
+    m_hash( geosx::dataRepository::keyHash( m_key ) ),
     m_index( INVALID_INDEX )
   {}
 
@@ -105,6 +109,13 @@ public:
   KEY_TYPE const & key() const
   { return m_key; }
 
+  /**
+   * @brief Access for the hash of the key.
+   * @return the hash of the key
+   */
+  geosx::dataRepository::KeyHashType hash() const
+  { return m_hash; }
+
   /**
    * @brief Access for the index.
    * @return a const reference to the index
@@ -134,6 +145,9 @@ private:
   /// const key value
   KEY_TYPE const m_key;
 
+  /// hash of the key
+  geosx::dataRepository::KeyHashType const m_hash;
+
   /// index value
   INDEX_TYPE mutable m_index;
 };
@@ -26,6 +26,7 @@
 #include "LvArray/src/limits.hpp"
 
 // System includes
+#include <unordered_map>
 #include <vector>
 
 namespace geosx
@@ -40,6 +41,10 @@ namespace geosx
  *
  * In addition, a keyIndex can be used for lookup, which will give similar
  * performance to an index lookup after the first use of a keyIndex.
+ *
+ * The lookup table is indexed by the FNV-1a hash of the keys (see keyHash()), so
+ * that a lookup with a character string or a keyIndex (which stores the hash of its key)
+ * neither constructs a temporary key nor hashes the key with std::hash.
  */
 template< typename T,
           typename T_PTR=T *,
@@ -57,8 +62,8 @@ public:
   /// pointer to the value type
   using mapped_type   = T_PTR;
 
-  /// the type of the lookup map
-  using LookupMapType          = std::unordered_map< KEY_TYPE, INDEX_TYPE >;
+  /// the type of the lookup map, from the hash of the keys to the indices (several keys may share a hash)
+  using LookupMapType          = std::unordered_multimap< dataRepository::KeyHashType, INDEX_TYPE >;
 
   /// the type of the values held in the vector
   using value_type             = typename std::pair< KEY_TYPE, T_PTR >;
@@ -174,10 +179,7 @@ public:
    * @return pointer to const T
    */
   inline T const * operator[]( KEY_TYPE const & keyName ) const
-  {
-    typename LookupMapType::const_iterator iter = m_keyLookup.find( keyName );
-    return ( iter!=m_keyLookup.end() ? this->operator[]( iter->second ) : nullptr );
-  }
+  { return this->operator[]( getIndex( keyName ) ); }
 
   /**
    *
@@ -187,6 +189,38 @@ public:
   inline T * operator[]( KEY_TYPE const & keyName )
   { return const_cast< T * >( const_cast< MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE > const * >(this)->operator[]( keyName ) ); }
 
+  /**
+   *
+   * @param keyName
+   * @return pointer to const T
+   */
+  inline T const * operator[]( char const * const keyName ) const
+  { return this->operator[]( getIndex( keyName ) ); }
+
+  /**
+   *
+   * @param keyName
+   * @return pointer to T
+   */
+  inline T * operator[]( char const * const keyName )
+  { return const_cast< T * >( const_cast< MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE > const * >(this)->operator[]( keyName ) ); }
+
+  /**
+   *
+   * @param hashedKey
+   * @return pointer to const T
+   */
+  inline T const * operator[]( dataRepository::HashedKey const & hashedKey ) const
+  { return this->operator[]( findIndex( hashedKey.hash, hashedKey.key ) ); }
+
+  /**
+   *
+   * @param hashedKey
+   * @return pointer to T
+   */
+  inline T * operator[]( dataRepository::HashedKey const & hashedKey )
+  { return const_cast< T * >( const_cast< MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE > const * >(this)->operator[]( hashedKey ) ); }
+
   /**
    *
    * @param keyIndex
@@ -198,13 +232,13 @@ public:
 
     if( index==KeyIndex::invalid_index )
     {
-      index = getIndex( keyIndex.key() );
+      index = findIndex( keyIndex.hash(), keyIndex.key() );
       keyIndex.setIndex( index );
     }
 #ifdef MAPPED_VECTOR_RANGE_CHECKING
-    else if( m_values[index].first!=keyIndex.Key() )
+    else if( m_values[index].first!=keyIndex.key() )
     {
-      index = getIndex( keyIndex.Key() );
+      index = findIndex( keyIndex.hash(), keyIndex.key() );
       keyIndex.setIndex( index );
     }
 #endif
@@ -278,10 +312,15 @@ public:
    * @return index associated with key
    */
   inline INDEX_TYPE getIndex( KEY_TYPE const & key ) const
-  {
-    typename LookupMapType::const_iterator iter = m_keyLookup.find( key );
-    return ( iter!=m_keyLookup.end() ? iter->second : KeyIndex::invalid_index );
-  }
+  { return findIndex( dataRepository::keyHash( key ), key ); }
+
+  /**
+   *
+   * @param key value of the key to use in the lookup
+   * @return index associated with key
+   */
+  inline INDEX_TYPE getIndex( char const * const key ) const
+  { return findIndex( dataRepository::keyHash( key ), key ); }
 
 
   /**
@@ -316,9 +355,6 @@ public:
     // delete the pointed-to value, if owned
     deleteValue( index );
 
-    // delete lookup entry
-    m_keyLookup.erase( m_values[index].first );
-
     // delete and shift vector entries
     m_values.erase( m_values.begin() + index );
     m_ownsValues.erase( m_ownsValues.begin() + index );
@@ -326,16 +362,17 @@ public:
     // rebuild parts of const key vectors after deleted entry
     m_constKeyValues.resize( index );
     m_constValues.resize( index );
-    for( typename valueContainer::size_type i = index; i < m_values.size(); ++i )
+    for( INDEX_TYPE i = index; i < size(); ++i )
     {
-      m_constKeyValues.emplace_back( m_values[i].first, rawPtr( index ) );
-      m_constValues.emplace_back( m_values[i].first, rawPtr( index ) );
+      m_constKeyValues.emplace_back( m_values[i].first, rawPtr( i ) );
+      m_constValues.emplace_back( m_values[i].first, rawPtr( i ) );
     }
 
-    // adjust lookup map indices
-    for( typename valueContainer::size_type i = index; i < m_values.size(); ++i )
+    // rebuild the lookup map, since the indices after the deleted entry have shifted
+    m_keyLookup.clear();
+    for( INDEX_TYPE i = 0; i < size(); ++i )
     {
-      m_keyLookup[m_values[i].first] = i;
+      m_keyLookup.emplace( dataRepository::keyHash( m_values[i].first ), i );
     }
   }
 
@@ -347,10 +384,10 @@ public:
    */
   void erase( KEY_TYPE const & key )
   {
-    typename LookupMapType::const_iterator iter = m_keyLookup.find( key );
-    if( iter!=m_keyLookup.end() )
+    INDEX_TYPE const index = getIndex( key );
+    if( index!=KeyIndex::invalid_index )
     {
-      erase( iter->second );
+      erase( index );
     }
   }
 
@@ -362,11 +399,11 @@ public:
    */
   void erase( KeyIndex & keyIndex )
   {
-    INDEX_TYPE index = keyIndex.Index();
+    INDEX_TYPE index = keyIndex.index();
 
-    if( (index==KeyIndex::invalid_index) || (m_values[index].first!=keyIndex.Key()) )
+    if( (index==KeyIndex::invalid_index) || (m_values[index].first!=keyIndex.key()) )
     {
-      index = getIndex( keyIndex.Key() );
+      index = findIndex( keyIndex.hash(), keyIndex.key() );
       keyIndex.setIndex( index );
     }
     erase( index );
@@ -416,7 +453,7 @@ public:
 
   /**
    * @brief access for key lookup
-   * @return reference lookup map
+   * @return reference lookup map, from the hash of the keys to their indices
    */
   inline LookupMapType const & keys() const
   { return m_keyLookup; }
@@ -424,6 +461,27 @@ public:
 
 private:
 
+  /**
+   * @brief Find the index of a key from its hash.
+   * @tparam K the type of the key (KEY_TYPE or a null-terminated character string)
+   * @param hash the hash of the key
+   * @param key the key, compared to the keys sharing its hash
+   * @return index associated with key
+   */
+  template< typename K >
+  INDEX_TYPE findIndex( dataRepository::KeyHashType const hash, K const & key ) const
+  {
+    auto const range = m_keyLookup.equal_range( hash );
+    for( typename LookupMapType::const_iterator iter = range.first; iter != range.second; ++iter )
+    {
+      if( m_values[iter->second].first == key )
+      {
+        return iter->second;
+      }
+    }
+    return KeyIndex::invalid_index;
+  }
+
   T * rawPtr( INDEX_TYPE index )
   {
     return &(*(m_values[index].second));
@@ -466,12 +524,12 @@ T * MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE >::insert( KEY_TYPE const & key
                                                             bool takeOwnership,
                                                             bool overwrite )
 {
-  INDEX_TYPE index = KeyIndex::invalid_index;
-  typename LookupMapType::iterator iterKeyLookup = m_keyLookup.find( keyName );
+  dataRepository::KeyHashType const hash = dataRepository::keyHash( keyName );
+  INDEX_TYPE index = findIndex( hash, keyName );
 
 
   // if the key was not found, make DataObject<T> and insert
-  if( iterKeyLookup == m_keyLookup.end() )
+  if( index == KeyIndex::invalid_index )
   {
     value_type newEntry = std::make_pair( keyName, std::move( source ) );
     m_values.push_back( std::move( newEntry ) );
@@ -483,7 +541,7 @@ T * MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE >::insert( KEY_TYPE const & key
       m_ownsValues[index] = true;
     }
 
-    m_keyLookup.insert( std::make_pair( keyName, index ) );
+    m_keyLookup.emplace( hash, index );
     m_constKeyValues.emplace_back( keyName, rawPtr( index ) );
     m_constValues.emplace_back( keyName, rawPtr( index ) );
 
@@ -491,8 +549,6 @@ T * MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE >::insert( KEY_TYPE const & key
   // if key was found
   else
   {
-    index = iterKeyLookup->second;
-
     if( takeOwnership )
     {
       m_ownsValues[index] = true;
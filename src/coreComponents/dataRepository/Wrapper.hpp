@@ -399,6 +399,8 @@ public:
   virtual
   localIndex unpack( buffer_unit_type const * & buffer, bool withMetadata, bool onDevice, parallelDeviceEvents & events ) override final
   {
+    // the sender may have allocated a wrapper that this rank never wrote to
+    allocateOnWrite();
     localIndex unpackedSize = 0;
     if( withMetadata )
     {
@@ -432,6 +434,8 @@ public:
     localIndex unpackedSize = 0;
     if( sizedFromParent()==1 )
     {
+      // the sender may have allocated a wrapper that this rank never wrote to
+      allocateOnWrite();
       if( withMetadata )
       {
         string name;
@@ -467,6 +471,10 @@ public:
   virtual localIndex elementByteSize() const override
   { return wrapperHelpers::byteSizeOfElement< T >(); }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual localIndex bytesAllocated() const override
+  { return wrapperHelpers::byteSizeAllocated( *m_data ); }
+
   /**
    * @name Methods that delegate to the wrapped type
    *
@@ -482,6 +490,7 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( int ndims, localIndex const * const dims ) override
   {
+    m_allocated = true;
     wrapperHelpers::move( *m_data, LvArray::MemorySpace::host, true );
     wrapperHelpers::resizeDimensions( *m_data, ndims, dims );
   }
@@ -489,8 +498,12 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void reserve( localIndex const newCapacity ) override
   {
+    if( !m_allocated )
+    {
+      return;
+    }
     wrapperHelpers::move( *m_data, LvArray::MemorySpace::host, true );
-    wrapperHelpers::reserve( reference(), newCapacity );
+    wrapperHelpers::reserve( *m_data, newCapacity );
   }
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,8 +516,26 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( localIndex const newSize ) override
   {
+    if( !m_allocated )
+    {
+      return;
+    }
     wrapperHelpers::move( *m_data, LvArray::MemorySpace::host, true );
-    wrapperHelpers::resizeDefault( reference(), newSize, m_default );
+    wrapperHelpers::resizeDefault( *m_data, newSize, m_default );
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual void allocate() override
+  {
+    if( m_allocated )
+    {
+      return;
+    }
+    m_allocated = true;
+    if( sizedFromParent() == 1 )
+    {
+      WrapperBase::resize();
+    }
   }
 
   /// @cond DO_NOT_DOCUMENT
@@ -541,9 +572,9 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void copy( localIndex const sourceIndex, localIndex const destIndex ) override
   {
-    if( sizedFromParent() )
+    if( sizedFromParent() && m_allocated )
     {
-      copy_wrapper::copy( reference(), sourceIndex, destIndex );
+      copy_wrapper::copy( *m_data, sourceIndex, destIndex );
     }
   }
 
@@ -576,7 +607,10 @@ public:
    * @return reference to T
    */
   T & reference()
-  { return *m_data; }
+  {
+    allocateOnWrite();
+    return *m_data;
+  }
 
   /**
    * @brief const Accessor for m_data
@@ -596,14 +630,20 @@ public:
    */
   template< typename _T=T, typename=std::enable_if_t< traits::HasMemberFunction_toView< _T > > >
   GEOSX_DECLTYPE_AUTO_RETURN referenceAsView()
-  { return m_data->toView(); }
+  {
+    allocateOnWrite();
+    return m_data->toView();
+  }
 
   /**
    * @copydoc referenceAsView()
    */
   template< typename _T=T, typename=std::enable_if_t< !traits::HasMemberFunction_toView< _T > > >
   T & referenceAsView()
-  { return *m_data; }
+  {
+    allocateOnWrite();
+    return *m_data;
+  }
 
   /**
    * @copydoc referenceAsView()
@@ -748,7 +788,7 @@ public:
    *       LvArray objects implement this method.
    */
   void setName()
-  { wrapperHelpers::setName( reference(), m_conduitNode.path() ); }
+  { wrapperHelpers::setName( *m_data, m_conduitNode.path() ); }
 
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -789,6 +829,13 @@ public:
       return;
     }
 
+    if( !m_allocated )
+    {
+      // the data was never written to, there is nothing to restart from
+      m_conduitNode[ "__unallocated__" ].set( 1 );
+      return;
+    }
+
     move( LvArray::MemorySpace::host, false );
 
     m_conduitNode[ "__sizedFromParent__" ].set( sizedFromParent() );
@@ -810,8 +857,16 @@ public:
       return false;
     }
 
+    if( m_conduitNode.has_child( "__unallocated__" ) )
+    {
+      // the wrapper keeps (or gets, if allocated) its default value
+      m_conduitNode.reset();
+      return false;
+    }
+
     setSizedFromParent( m_conduitNode[ "__sizedFromParent__" ].value() );
 
+    m_allocated = true;
     wrapperHelpers::pullDataFromConduitNode( *m_data, m_conduitNode );
 
     m_conduitNode.reset();
@@ -877,6 +932,15 @@ public:
     return *this;
   }
 
+  /**
+   * @copydoc WrapperBase::setLazyAllocation(bool const)
+   */
+  Wrapper< T > & setLazyAllocation( bool const lazy = true )
+  {
+    WrapperBase::setLazyAllocation( lazy );
+    return *this;
+  }
+
   /**
    * @copydoc WrapperBase::setRegisteringObjects(string const &)
    */
@@ -912,6 +976,26 @@ public:
 #endif
 
 private:
+
+  /**
+   * @brief Allocate the storage of a lazily allocated wrapper before handing out a non-const access to it.
+   */
+  void allocateOnWrite()
+  {
+    if( !m_allocated )
+    {
+      allocate();
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual void deallocate() override
+  {
+    m_allocated = false;
+    wrapperHelpers::deallocate( *m_data );
+    setName();
+  }
+
   /// flag to indicate whether or not this wrapper is responsible for allocation/deallocation of the object at the
   /// address of m_data
   bool m_ownsData;
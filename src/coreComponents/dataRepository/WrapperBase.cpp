@@ -19,6 +19,8 @@
 #include "Group.hpp"
 #include "RestartFlags.hpp"
 
+#include <algorithm>
+
 
 namespace geosx
 {
@@ -33,6 +35,8 @@ WrapperBase::WrapperBase( string const & name,
   m_sizedFromParent( 1 ),
   m_restart_flags( RestartFlags::WRITE_AND_READ ),
   m_plotLevel( PlotLevel::NOPLOT ),
+  m_lazyAllocation( false ),
+  m_allocated( true ),
   m_inputFlag( InputFlags::INVALID ),
   m_successfulReadFromInput( false ),
   m_description(),
@@ -49,11 +53,36 @@ void WrapperBase::resize()
   resize( m_parent->size());
 }
 
+WrapperBase & WrapperBase::setLazyAllocation( bool const lazy )
+{
+  m_lazyAllocation = lazy;
+  if( lazy && m_allocated )
+  {
+    deallocate();
+  }
+  else if( !lazy )
+  {
+    allocate();
+  }
+  return *this;
+}
+
+localIndex WrapperBase::deferredByteSize() const
+{
+  if( m_allocated || m_sizedFromParent != 1 )
+  {
+    return 0;
+  }
+  return m_parent->size() * std::max( numArrayComp(), localIndex( 1 ) ) * elementByteSize();
+}
+
 void WrapperBase::copyWrapperAttributes( WrapperBase const & source )
 {
   m_sizedFromParent = source.m_sizedFromParent;
   m_restart_flags = source.m_restart_flags;
   m_plotLevel  = source.m_plotLevel;
+  m_lazyAllocation = source.m_lazyAllocation;
+  m_allocated = source.m_allocated;
   m_inputFlag = source.m_inputFlag;
   m_description = source.m_description;
 }
@@ -93,6 +122,8 @@ int WrapperBase::setTotalviewDisplay() const
   TV_ttf_add_row( "m_sizedFromParent", "int", &m_sizedFromParent );
   TV_ttf_add_row( "m_restart_flags", LvArray::system::demangle< RestartFlags >().c_str(), &m_restart_flags );
   TV_ttf_add_row( "m_plotLevel", LvArray::system::demangle< PlotLevel >().c_str(), &m_plotLevel );
+  TV_ttf_add_row( "m_lazyAllocation", "bool", &m_lazyAllocation );
+  TV_ttf_add_row( "m_allocated", "bool", &m_allocated );
   TV_ttf_add_row( "m_inputFlag", LvArray::system::demangle< InputFlags >().c_str(), &m_inputFlag );
   TV_ttf_add_row( "m_description", LvArray::system::demangle< string >().c_str(), &m_description );
   size_t junk = m_registeringObjects.size();
@@ -107,6 +107,12 @@ public:
    */
   virtual localIndex elementByteSize() const = 0;
 
+  /**
+   * @brief @return the number of bytes allocated by the wrapped object, including its unused capacity.
+   * @note For the arrays of arrays or of sets this includes the offsets and the sizes of the sub-arrays.
+   */
+  virtual localIndex bytesAllocated() const = 0;
+
   /**
    * @brief Calls T::resize( num_dims, dims )
    * @param[in] num_dims number of dimensions in T
@@ -407,6 +413,49 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Check whether the storage of this wrapper is only allocated on first write access.
+   * @return @p true if the wrapper is lazily allocated, @p false otherwise
+   */
+  bool isLazyAllocation() const
+  {
+    return m_lazyAllocation;
+  }
+
+  /**
+   * @brief Check whether the wrapped object holds its storage.
+   * @return @p false if the wrapper is lazily allocated and was never accessed for writing, @p true otherwise
+   */
+  bool isAllocated() const
+  {
+    return m_allocated;
+  }
+
+  /**
+   * @brief Set whether the storage of this wrapper is only allocated on first write access.
+   * @param lazy the new lazy allocation flag
+   * @return a reference to this wrapper
+   *
+   * A lazily allocated wrapper releases its storage (keeping the sizes of the dimensions other than the
+   * first one) and allocates it again, sized from its parent and set to its default value, on the first
+   * non-const access to the wrapped object. Until then it is not resized with its parent and not written
+   * to restart files. Unpacking data into the wrapper allocates it, and the field synchronizations allocate
+   * it on all the ranks as soon as one of them has allocated it.
+   * @note Since the storage is released, the flag must be set right after the registration of the wrapper.
+   */
+  WrapperBase & setLazyAllocation( bool const lazy = true );
+
+  /**
+   * @brief Allocate the storage of a wrapper that was never accessed for writing, a no-op otherwise.
+   */
+  virtual void allocate() = 0;
+
+  /**
+   * @brief Get the number of bytes that the wrapper would hold once allocated.
+   * @return the number of bytes saved by the lazy allocation, or 0 if the wrapper is allocated
+   */
+  localIndex deferredByteSize() const;
+
   /**
    * @brief Get name of the wrapper.
    * @return name of the wrapper
@@ -622,6 +671,11 @@ protected:
 
   /// @endcond
 
+  /**
+   * @brief Release the storage of the wrapped object, keeping the sizes of its dimensions other than the first one.
+   */
+  virtual void deallocate() = 0;
+
 protected:
 
   /// Name of the object that is being wrapped
@@ -639,6 +693,12 @@ protected:
   /// Flag to store the plotLevel
   PlotLevel m_plotLevel;
 
+  /// Flag to indicate whether the storage of the wrapped object is only allocated on first write access
+  bool m_lazyAllocation;
+
+  /// Flag to indicate whether the wrapped object holds its storage
+  bool m_allocated;
+
   /// Flag to store if this wrapped object should be read from input
   InputFlags m_inputFlag;
 
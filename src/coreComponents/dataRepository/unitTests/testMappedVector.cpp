@@ -0,0 +1,109 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "dataRepository/MappedVector.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <string>
+
+using namespace geosx;
+using namespace dataRepository;
+
+using IntMap = MappedVector< int, int *, std::string, int >;
+
+TEST( testMappedVector, keyHash )
+{
+  // reference values of the 64-bit FNV-1a hash
+  static_assert( keyHash( "" ) == 14695981039346656037ULL, "Wrong hash of the empty key" );
+  static_assert( keyHash( "a" ) == 0xaf63dc4c8601ec8cULL, "Wrong hash of a one character key" );
+
+  constexpr HashedKey key( "pressure" );
+  static_assert( key.hash == keyHash( "pressure" ), "Wrong hash of a HashedKey" );
+  EXPECT_EQ( keyHash( std::string( "pressure" ) ), key.hash );
+}
+
+/// Key accessor in the style of the viewKeyStruct accessors
+struct testKeyStruct
+{
+  static constexpr char const * pressureString() { return "pressure"; }
+};
+
+TEST( testMappedVector, hashedViewKey )
+{
+  HashedKey const & key = hashedKey< testKeyStruct::pressureString >();
+  EXPECT_STREQ( key.key, "pressure" );
+  EXPECT_EQ( key.hash, keyHash( "pressure" ) );
+
+  IntMap map;
+  int * const p = map.insert( "pressure", new int( 1 ), true );
+  EXPECT_EQ( map[ hashedKey< testKeyStruct::pressureString >() ], p );
+}
+
+TEST( testMappedVector, lookup )
+{
+  IntMap map;
+  int * const a = map.insert( "a", new int( 1 ), true );
+  int * const b = map.insert( "b", new int( 2 ), true );
+  int * const c = map.insert( "c", new int( 3 ), true );
+
+  EXPECT_EQ( map.size(), 3 );
+
+  EXPECT_EQ( map[ std::string( "b" ) ], b );
+  EXPECT_EQ( map[ "b" ], b );
+  EXPECT_EQ( map[ HashedKey( "c" ) ], c );
+  EXPECT_EQ( map[ 0 ], a );
+  EXPECT_EQ( map.getIndex( "c" ), 2 );
+
+  IntMap::KeyIndex const keyIndex( "c" );
+  EXPECT_EQ( map[ keyIndex ], c );
+  EXPECT_EQ( keyIndex.index(), 2 );
+
+  EXPECT_EQ( map[ "d" ], nullptr );
+  EXPECT_EQ( map[ HashedKey( "d" ) ], nullptr );
+  EXPECT_EQ( map.getIndex( std::string( "d" ) ), int( IntMap::KeyIndex::invalid_index ) );
+
+  IntMap const & constMap = map;
+  EXPECT_EQ( constMap[ "a" ], a );
+}
+
+TEST( testMappedVector, erase )
+{
+  IntMap map;
+  map.insert( "a", new int( 1 ), true );
+  map.insert( "b", new int( 2 ), true );
+  map.insert( "c", new int( 3 ), true );
+  map.insert( "d", new int( 4 ), true );
+
+  map.erase( std::string( "b" ) );
+
+  ASSERT_EQ( map.size(), 3 );
+  EXPECT_EQ( map[ "b" ], nullptr );
+  EXPECT_EQ( map.getIndex( "a" ), 0 );
+  EXPECT_EQ( map.getIndex( "c" ), 1 );
+  EXPECT_EQ( map.getIndex( "d" ), 2 );
+  EXPECT_EQ( *map[ "c" ], 3 );
+  EXPECT_EQ( *map[ "d" ], 4 );
+
+  // the iteration must see the values shifted after the erased entry
+  int expected[] = { 1, 3, 4 };
+  int i = 0;
+  for( auto const & keyValue : map )
+  {
+    EXPECT_EQ( *keyValue.second, expected[i++] );
+  }
+}
@@ -109,6 +109,23 @@ public:
     }
   }
 
+  void testLazyAllocation( bool const value )
+  {
+    {
+      Wrapper< T > & rval = m_wrapper.setLazyAllocation( value );
+      EXPECT_EQ( value, m_wrapper.isLazyAllocation() );
+      EXPECT_EQ( !value, m_wrapper.isAllocated() );
+      EXPECT_EQ( &rval, &m_wrapper );
+    }
+
+    {
+      WrapperBase & rval = m_wrapperBase.setLazyAllocation( value );
+      EXPECT_EQ( value, m_wrapperBase.isLazyAllocation() );
+      EXPECT_EQ( !value, m_wrapperBase.isAllocated() );
+      EXPECT_EQ( &rval, &m_wrapperBase );
+    }
+  }
+
 private:
   conduit::Node m_node;
   Group m_group;
@@ -149,3 +166,106 @@ TYPED_TEST( WrapperSetGet, Description )
   this->testDescription( "First description." );
   this->testDescription( "Second description." );
 }
+
+TYPED_TEST( WrapperSetGet, LazyAllocation )
+{
+  this->testLazyAllocation( true );
+  this->testLazyAllocation( false );
+}
+
+TEST( testWrapper, lazyAllocation )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  group.resize( 10 );
+
+  Wrapper< array2d< real64 > > & wrapper = group.registerWrapper< array2d< real64 > >( "wrapper" );
+  wrapper.setApplyDefaultValue( 1.0 );
+  wrapper.reference().resizeDimension< 1 >( 3 );
+  wrapper.setLazyAllocation();
+
+  EXPECT_FALSE( wrapper.isAllocated() );
+  EXPECT_EQ( wrapper.size(), 0 );
+  EXPECT_EQ( wrapper.numArrayComp(), 3 );
+  EXPECT_EQ( wrapper.deferredByteSize(), localIndex( 10 * 3 * sizeof( real64 ) ) );
+
+  // the storage is neither resized with the parent nor allocated by a const access
+  group.resize( 20 );
+  Wrapper< array2d< real64 > > const & constWrapper = wrapper;
+  EXPECT_EQ( constWrapper.reference().size( 0 ), 0 );
+  EXPECT_FALSE( wrapper.isAllocated() );
+
+  // the first non-const access allocates the storage with the size of the parent and the default value
+  arrayView2d< real64 > const data = wrapper.referenceAsView();
+  EXPECT_TRUE( wrapper.isAllocated() );
+  ASSERT_EQ( data.size( 0 ), 20 );
+  ASSERT_EQ( data.size( 1 ), 3 );
+  EXPECT_EQ( data( 19, 2 ), 1.0 );
+  EXPECT_EQ( wrapper.deferredByteSize(), 0 );
+
+  group.resize( 30 );
+  EXPECT_EQ( wrapper.size(), 30 * 3 );
+}
+
+TEST( testWrapper, lazyAllocationUnpack )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  group.resize( 10 );
+
+  Wrapper< array2d< real64 > > & source = group.registerWrapper< array2d< real64 > >( "source" );
+  source.reference().resizeDimension< 1 >( 3 );
+  arrayView2d< real64 > const sourceData = source.referenceAsView();
+  for( localIndex i = 0; i < 10; ++i )
+  {
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      sourceData( i, j ) = 10 * i + j;
+    }
+  }
+
+  Wrapper< array2d< real64 > > & target = group.registerWrapper< array2d< real64 > >( "target" );
+  target.reference().resizeDimension< 1 >( 3 );
+  target.setLazyAllocation();
+
+  array1d< localIndex > indices( 2 );
+  indices[0] = 2;
+  indices[1] = 7;
+  parallelDeviceEvents events;
+  array1d< buffer_unit_type > buffer( source.packByIndexSize( indices.toViewConst(), true, false, events ) );
+  buffer_unit_type * packBuffer = buffer.data();
+  source.packByIndex( packBuffer, indices.toViewConst(), true, false, events );
+
+  // unpacking into a wrapper that was never written to allocates it first
+  buffer_unit_type const * unpackBuffer = buffer.data();
+  target.unpackByIndex( unpackBuffer, indices.toViewConst(), true, false, events );
+  EXPECT_TRUE( target.isAllocated() );
+
+  arrayView2d< real64 const > const targetData = target.reference();
+  ASSERT_EQ( targetData.size( 0 ), 10 );
+  for( localIndex j = 0; j < 3; ++j )
+  {
+    EXPECT_EQ( targetData( 2, j ), sourceData( 2, j ) );
+    EXPECT_EQ( targetData( 7, j ), sourceData( 7, j ) );
+  }
+}
+
+TEST( testWrapper, bytesAllocated )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  Group & subGroup = group.registerGroup( "subGroup" );
+  localIndex const initialBytes = group.bytesAllocated();
+
+  // the unused capacity is accounted for
+  Wrapper< array1d< real64 > > & wrapper = group.registerWrapper< array1d< real64 > >( "wrapper" );
+  wrapper.reference().reserve( 100 );
+  wrapper.reference().resize( 10 );
+  EXPECT_EQ( wrapper.bytesAllocated(), localIndex( 100 * sizeof( real64 ) ) );
+
+  Wrapper< array2d< integer > > & subWrapper = subGroup.registerWrapper< array2d< integer > >( "subWrapper" );
+  subWrapper.reference().resize( 10, 2 );
+  EXPECT_EQ( subWrapper.bytesAllocated(), localIndex( 10 * 2 * sizeof( integer ) ) );
+
+  EXPECT_EQ( group.bytesAllocated() - initialBytes, wrapper.bytesAllocated() + subWrapper.bytesAllocated() );
+}
@@ -219,6 +219,29 @@ resizeDimensions( T & value, int num_dims, localIndex const * const dims )
 }
 
 
+template< typename T, int NDIM, typename PERMUTATION >
+inline void
+deallocate( Array< T, NDIM, PERMUTATION > & value )
+{
+  // Keep the sizes of the dimensions other than the first one, which are set at registration.
+  localIndex dims[ NDIM ];
+  for( int i = 1; i < NDIM; ++i )
+  {
+    dims[ i ] = value.size( i );
+  }
+  dims[ 0 ] = 0;
+
+  Array< T, NDIM, PERMUTATION > empty;
+  empty.resize( NDIM, dims );
+  value = std::move( empty );
+}
+
+template< typename T >
+inline void
+deallocate( T & value )
+{ resize( value, 0 ); }
+
+
 template< typename T >
 inline localIndex
 byteSizeOfElement()
@@ -262,6 +285,20 @@ capacity( T const & value )
 { return size( value ); }
 
 
+template< typename T >
+inline std::enable_if_t< !traits::HasMemberFunction_valueCapacity< T const >, localIndex >
+byteSizeAllocated( T const & value )
+{ return capacity( value ) * byteSizeOfElement< T >(); }
+
+// This is for the arrays of arrays and of sets, which also allocate the offsets and the sizes of the sub-arrays.
+template< typename T >
+inline std::enable_if_t< traits::HasMemberFunction_valueCapacity< T const >, localIndex >
+byteSizeAllocated( T const & value )
+{
+  return value.valueCapacity() * LvArray::integerConversion< localIndex >( sizeof( typename T::ValueType ) ) +
+         ( 2 * value.capacity() + 1 ) * LvArray::integerConversion< localIndex >( sizeof( localIndex ) );
+}
+
 
 template< typename T >
 std::enable_if_t< traits::HasMemberFunction_setName< T > >
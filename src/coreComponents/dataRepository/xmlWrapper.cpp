@@ -132,6 +132,15 @@ void addIncludedXML( xmlNode & targetNode, int const level )
   {}
 }
 
+void addIncludedXMLRecursive( xmlNode & targetNode )
+{
+  addIncludedXML( targetNode );
+  for( xmlNode childNode : targetNode.children() )
+  {
+    addIncludedXMLRecursive( childNode );
+  }
+}
+
 string buildMultipleInputXML( string_array const & inputFileList,
                               string const & outputDir )
 {
@@ -86,6 +86,15 @@ constexpr char const includedFileTag[] = "File";
  */
 void addIncludedXML( xmlNode & targetNode, int level = 0 );
 
+/**
+ * @brief Function to add xml nodes from included files in a whole subtree.
+ * @param targetNode the root of the subtree for which to look for included children specifications
+ *
+ * Applies addIncludedXML() to @p targetNode and to all its descendants, so that the resulting
+ * subtree no longer references any other file.
+ */
+void addIncludedXMLRecursive( xmlNode & targetNode );
+
 /**
  * @brief Function to handle multiple input xml files.
  * @param inputFileList the list of input xml files
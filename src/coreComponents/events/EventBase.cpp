@@ -254,6 +254,17 @@ bool EventBase::execute( real64 const time_n,
 }
 
 
+bool EventBase::hasGloballyConsistentTimestepRequest() const
+{
+  bool consistent = ( m_target == nullptr ) || m_target->hasGloballyConsistentTimestepRequest();
+  this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+  {
+    consistent = consistent && subEvent.hasGloballyConsistentTimestepRequest();
+  } );
+  return consistent;
+}
+
+
 real64 EventBase::getTimestepRequest( real64 const time )
 {
   m_currentEventDtRequest = std::numeric_limits< real64 >::max() / 2.0;
@@ -149,6 +149,13 @@ public:
    */
   virtual real64 getTimestepRequest( real64 const time ) override;
 
+  /**
+   * @brief Tell whether the timestep requests of this event are identical on all the ranks.
+   * @return true if the requests of the target and of the sub-events are globally consistent
+   * @note The event-specific requests only depend on the time and on the forecasts, which are identical on all the ranks.
+   */
+  virtual bool hasGloballyConsistentTimestepRequest() const override;
+
   /**
    * @brief Get event-specifit dt requests.
    * @param time The current simulation time.
@@ -18,7 +18,9 @@
 
 #include "EventManager.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "common/TimingMacros.hpp"
+#include "common/initializeEnvironment.hpp"
 #include "events/EventBase.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
@@ -33,6 +35,7 @@ EventManager::EventManager( string const & name,
   Group( name, parent ),
   m_maxTime(),
   m_maxCycle(),
+  m_alwaysReduceDt(),
   m_time(),
   m_dt(),
   m_cycle(),
@@ -53,6 +56,12 @@ EventManager::EventManager( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum simulation cycle for the global event loop." );
 
+  registerWrapper( viewKeyStruct::alwaysReduceDtString(), &m_alwaysReduceDt ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to reduce the cycle dt across the ranks every cycle (1), "
+                    "instead of only when some event or target requests a dt that may differ between the ranks (0)." );
+
   registerWrapper( viewKeyStruct::timeString(), &m_time ).
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "Current simulation time." );
@@ -115,6 +124,14 @@ bool EventManager::run( DomainPartition & domain )
     subEvent.setProgressIndicator( eventCounters );
   } );
 
+  // The dt requests identical on all the ranks do not need a global reduction every cycle
+  bool reduceDt = m_alwaysReduceDt != 0;
+  this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+  {
+    reduceDt = reduceDt || !subEvent.hasGloballyConsistentTimestepRequest();
+  } );
+  GEOSX_LOG_LEVEL_RANK_0( 1, "The cycle dt is " << ( reduceDt ? "" : "not " ) << "reduced across the ranks" );
+
   // Inform user if it appears this is a mid-loop restart
   if((m_currentSubEvent > 0))
   {
@@ -128,6 +145,8 @@ bool EventManager::run( DomainPartition & domain )
     // Determine the cycle timestep
     if( m_currentSubEvent == 0 )
     {
+      GEOSX_MARK_SCOPE( timestepRequest );
+
       // The max dt request
       m_dt = m_maxTime - m_time;
 
@@ -139,12 +158,11 @@ bool EventManager::run( DomainPartition & domain )
       }
       m_currentSubEvent = 0;
 
-#ifdef GEOSX_USE_MPI
       // Find the min dt across processes
-      real64 dt_global;
-      MPI_Allreduce( &m_dt, &dt_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_GEOSX );
-      m_dt = dt_global;
-#endif
+      if( reduceDt )
+      {
+        m_dt = MpiWrapper::min( m_dt );
+      }
     }
 
     GEOSX_LOG_RANK_0( "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
@@ -155,7 +173,10 @@ bool EventManager::run( DomainPartition & domain )
       EventBase * subEvent = static_cast< EventBase * >( this->getSubGroups()[m_currentSubEvent] );
 
       // Calculate the event and sub-event forecasts
-      subEvent->checkEvents( m_time, m_dt, m_cycle, domain );
+      {
+        GEOSX_MARK_SCOPE( checkEvents );
+        subEvent->checkEvents( m_time, m_dt, m_cycle, domain );
+      }
 
       // Print debug information for logLevel >= 1
       GEOSX_LOG_LEVEL_RANK_0( 1,
@@ -189,6 +210,12 @@ bool EventManager::run( DomainPartition & domain )
     m_time += m_dt;
     ++m_cycle;
     m_currentSubEvent = 0;
+
+    // Print the memory allocations of the ranks that received SIGUSR1 (not collective)
+    if( consumeMemoryReportRequest() )
+    {
+      getParent().printMemoryAllocation( 1024 * 1024, false );
+    }
   }
 
   // Cleanup
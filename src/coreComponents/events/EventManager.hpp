@@ -74,7 +74,8 @@ public:
    *   - Calculate the event forecast (number of cycles until its expected execution)
    *   - Signal an event to prepare (forecast == 1)
    *   - Execute an event (forecast == 0)
-   *   - Determine dt for the next cycle
+   *   - Determine dt for the next cycle (reduced across the ranks only if some request is not globally consistent,
+   *     or if alwaysReduceDt is set)
    *   - Advance time, cycle, etc.
    */
   bool run( DomainPartition & domain );
@@ -88,6 +89,7 @@ public:
   {
     static constexpr char const * maxTimeString() { return "maxTime"; }
     static constexpr char const * maxCycleString() { return "maxCycle"; }
+    static constexpr char const * alwaysReduceDtString() { return "alwaysReduceDt"; }
 
     static constexpr char const * timeString() { return "time"; }
     static constexpr char const * dtString() { return "dt"; }
@@ -117,6 +119,9 @@ private:
   /// Maximum number of cycles for a simulation
   integer m_maxCycle;
 
+  /// Flag to reduce the cycle dt across the ranks even if the requests are globally consistent
+  integer m_alwaysReduceDt;
+
   /// Simulation timestamp at the beginning of the cycle
   real64 m_time;
 
@@ -18,6 +18,8 @@
 
 #include "VTKOutput.hpp"
 
+#include "common/TimingMacros.hpp"
+
 namespace geosx
 {
 
@@ -68,6 +70,8 @@ bool VTKOutput::execute( real64 const time_n,
                          real64 const GEOSX_UNUSED_PARAM ( eventProgress ),
                          DomainPartition & domain )
 {
+  GEOSX_MARK_FUNCTION;
+
   if( m_writeBinaryData )
   {
     m_writer.setOutputMode( vtk::VTKOutputMode::BINARY );
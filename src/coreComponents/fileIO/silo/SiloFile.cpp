@@ -1233,7 +1233,7 @@ void SiloFile::writeElementRegionSilo( ElementRegionBase const & elemRegion,
     {
       WrapperBase const & wrapper = *wrapperIter.second;
 
-      if( wrapper.getPlotLevel() < m_plotLevel )
+      if( wrapper.getPlotLevel() < m_plotLevel && wrapper.isAllocated() )
       {
         // the field name is the key to the map
         string const & fieldName = wrapper.getName();
@@ -1991,7 +1991,7 @@ void SiloFile::writeWrappersToSilo( string const & meshname,
   {
     auto const & wrapper = wrapperIter.second;
 
-    if( wrapper->getPlotLevel() <= m_plotLevel )
+    if( wrapper->getPlotLevel() <= m_plotLevel && wrapper->isAllocated() )
     {
       // the field name is the key to the map
       string const & fieldName = wrapper->getName();
@@ -499,10 +499,12 @@ void writeElementField( Group const & subRegions,
   localIndex numElements = 0;
   bool first = true;
   int numDims = 0;
+  bool allocated = true;
   subRegions.forSubGroups< SUBREGION >( [&]( SUBREGION const & subRegion )
   {
     numElements += subRegion.size();
     WrapperBase const & wrapper = subRegion.getWrapperBase( field );
+    allocated = allocated && wrapper.isAllocated();
     if( first )
     {
       types::dispatch( types::StandardArrays{}, wrapper.getTypeId(), true, [&]( auto array )
@@ -528,6 +530,11 @@ void writeElementField( Group const & subRegions,
 
   data->SetNumberOfTuples( numElements );
   data->SetName( field.c_str() );
+  if( !allocated )
+  {
+    // the subregions holding a lazily allocated field that was never written to are output as zeros
+    data->Fill( 0 );
+  }
 
   // write each subregion in turn, keeping track of element offset
   localIndex offset = 0;
@@ -546,7 +553,7 @@ void VTKPolyDataWriterInterface::writeNodeFields( NodeManager const & nodeManage
   for( auto const & wrapperIter : nodeManager.wrappers() )
   {
     auto const & wrapper = *wrapperIter.second;
-    if( wrapper.getPlotLevel() <= m_plotLevel )
+    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.isAllocated() )
     {
       vtkSmartPointer< vtkDataArray > data;
       types::dispatch( types::StandardArrays{}, wrapper.getTypeId(), true, [&]( auto array )
@@ -608,7 +615,8 @@ void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & r
   {
     for( auto const & wrapperIter : subRegion.wrappers() )
     {
-      if( wrapperIter.second->getPlotLevel() <= m_plotLevel && materialFields.count( wrapperIter.first ) == 0 )
+      if( wrapperIter.second->getPlotLevel() <= m_plotLevel && wrapperIter.second->isAllocated() &&
+          materialFields.count( wrapperIter.first ) == 0 )
       {
         regularFields.insert( wrapperIter.first );
       }
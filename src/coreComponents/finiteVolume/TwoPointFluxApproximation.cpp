@@ -349,7 +349,9 @@ void TwoPointFluxApproximation::addToFractureStencil( MeshLevel & mesh,
     // doing the filtering
     // there and not here is that the ProppantTransport solver needs the connections numElems == 1 to produce correct results.
 
-    localIndex const connectorIndex = fractureStencil.size();
+    // the connections are indexed by connector, so that the connection of a connector that gained a face element
+    // is updated in place rather than duplicated
+    localIndex const connectorIndex = fci;
 
     GEOSX_ERROR_IF( numElems > maxElems, "Max stencil size exceeded by fracture-fracture connector " << fci );
 
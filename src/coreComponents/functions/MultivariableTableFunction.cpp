@@ -19,7 +19,9 @@
 #include "MultivariableTableFunction.hpp"
 
 #include "common/DataTypes.hpp"
+#include "common/Path.hpp"
 #include <algorithm>
+#include <sstream>
 
 namespace geosx
 {
@@ -33,8 +35,11 @@ MultivariableTableFunction::MultivariableTableFunction( const string & name,
 
 void MultivariableTableFunction::initializeFunctionFromFile( string const & filename )
 {
-  std::ifstream file( filename.c_str() );
-  GEOSX_THROW_IF( !file, catalogName() << " " << getName() << ": could not read input file " << filename, InputError );
+  // The file is read on rank 0 only and its contents are broadcast
+  string fileContents;
+  GEOSX_THROW_IF( !readFileCollectively( filename, fileContents ),
+                  catalogName() << " " << getName() << ": could not read input file " << filename, InputError );
+  std::istringstream file( fileContents );
 
   integer numDims, numOps;
   globalIndex numPointsTotal = 1;
@@ -101,8 +106,6 @@ void MultivariableTableFunction::initializeFunctionFromFile( string const & file
   file >> value;
   GEOSX_THROW_IF( file, catalogName() << " " << getName() << ": table file is longer than expected", InputError );
 
-  file.close();
-
   setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
   initializeFunction();
 }
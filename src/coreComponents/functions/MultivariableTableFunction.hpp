@@ -83,6 +83,7 @@ public:
   /**
    * @brief Initialize the table function using data from file
    * @param[in] filename The name of the file to read.
+   * @note This is a collective call: the file is read on rank 0 and its contents are broadcast.
    */
   void initializeFunctionFromFile( string const & filename );
 
@@ -18,7 +18,9 @@
 
 #include "TableFunction.hpp"
 #include "common/DataTypes.hpp"
+#include "common/Path.hpp"
 #include <algorithm>
+#include <sstream>
 
 namespace geosx
 {
@@ -58,11 +60,13 @@ TableFunction::TableFunction( const string & name,
 template< typename T >
 void TableFunction::parseFile( string const & filename, array1d< T > & target )
 {
-  std::ifstream inputStream( filename.c_str() );
-  GEOSX_THROW_IF( !inputStream, catalogName() << " " << getName() << ": could not read input file " << filename, InputError );
+  // The file is read on rank 0 only and its contents are broadcast
+  string fileContents;
+  GEOSX_THROW_IF( !readFileCollectively( filename, fileContents ),
+                  catalogName() << " " << getName() << ": could not read input file " << filename, InputError );
 
-  // Read the file
-  // TODO: Update this to handle large parallel jobs
+  // Parse the file contents
+  std::istringstream inputStream( fileContents );
   string lineString;
   while( std::getline( inputStream, lineString ) )
   {
@@ -81,8 +85,6 @@ void TableFunction::parseFile( string const & filename, array1d< T > & target )
       }
     }
   }
-
-  inputStream.close();
 }
 
 void TableFunction::setInterpolationMethod( InterpolationType const method )
@@ -160,6 +162,31 @@ void TableFunction::reInitializeFunction()
                            InputError );
   }
 
+  // Detect the evenly spaced axes, on which the interval lookup does not need a binary search
+  m_coordinateInvSpacing.resize( m_coordinates.size() );
+  for( localIndex ii = 0; ii < m_coordinates.size(); ++ii )
+  {
+    arraySlice1d< real64 const > const coords = m_coordinates[ii];
+    localIndex const numCoords = coords.size();
+    m_coordinateInvSpacing[ii] = 0.0;
+    if( numCoords < 2 )
+    {
+      continue;
+    }
+
+    real64 const spacing = ( coords[numCoords - 1] - coords[0] ) / ( numCoords - 1 );
+    real64 const tol = 1e-10 * LvArray::math::abs( coords[numCoords - 1] - coords[0] );
+    bool isEvenlySpaced = spacing > 0.0;
+    for( localIndex j = 1; isEvenlySpaced && j < numCoords - 1; ++j )
+    {
+      isEvenlySpaced = LvArray::math::abs( coords[j] - ( coords[0] + j * spacing ) ) <= tol;
+    }
+    if( isEvenlySpaced )
+    {
+      m_coordinateInvSpacing[ii] = 1.0 / spacing;
+    }
+  }
+
   // Create the kernel wrapper
   m_kernelWrapper = createKernelWrapper();
 }
@@ -168,6 +195,7 @@ TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
 {
   return KernelWrapper( m_interpolationMethod,
                         m_coordinates.toViewConst(),
+                        m_coordinateInvSpacing.toViewConst(),
                         m_values.toViewConst() );
 }
 
@@ -178,10 +206,12 @@ real64 TableFunction::evaluate( real64 const * const input ) const
 
 TableFunction::KernelWrapper::KernelWrapper( InterpolationType const interpolationMethod,
                                              ArrayOfArraysView< real64 const > const & coordinates,
+                                             arrayView1d< real64 const > const & coordinateInvSpacing,
                                              arrayView1d< real64 const > const & values )
   :
   m_interpolationMethod( interpolationMethod ),
   m_coordinates( coordinates ),
+  m_coordinateInvSpacing( coordinateInvSpacing ),
   m_values( values )
 {}
 
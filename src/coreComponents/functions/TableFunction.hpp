@@ -31,6 +31,10 @@ namespace geosx
  * @class TableFunction
  *
  * An interface for a dense table-based function
+ *
+ * The coordinate and voxel files are read on rank 0 and broadcast. The table data is not shared
+ * between the ranks of a node (e.g. through an MPI-3 shared memory window): it is stored in arrays
+ * that the kernel wrappers view and that may be moved to the device, so each rank holds its own copy.
  */
 class TableFunction : public FunctionBase
 {
@@ -71,6 +75,7 @@ public:
     KernelWrapper & operator=( KernelWrapper && other )
     {
       m_coordinates = std::move( other.m_coordinates );
+      m_coordinateInvSpacing = std::move( other.m_coordinateInvSpacing );
       m_values = std::move( other.m_values );
       m_interpolationMethod = other.m_interpolationMethod;
       return *this;
@@ -108,6 +113,7 @@ public:
     void move( LvArray::MemorySpace const space, bool const touch )
     {
       m_coordinates.move( space, touch );
+      m_coordinateInvSpacing.move( space, touch );
       m_values.move( space, touch );
     }
 
@@ -119,17 +125,25 @@ private:
      * @brief The constructor of the kernel wrapper
      * @param[in] interpolationMethod table interpolation method
      * @param[in] coordinates array of table axes
+     * @param[in] coordinateInvSpacing inverse of the spacing of each axis (zero if the axis is not evenly spaced)
      * @param[in] values table values (in fortran order)
-     * @param[in] dimensions number of active table dimensions
-     * @param[in] size size of the table
-     * @param[in] indexIncrement array used to locate values within ND tables
-     * @param[in] corners corners of the box that surround the value in N dimensions
-     * @param[in] numCorners number of active table corners
      */
     KernelWrapper( InterpolationType interpolationMethod,
                    ArrayOfArraysView< real64 const > const & coordinates,
+                   arrayView1d< real64 const > const & coordinateInvSpacing,
                    arrayView1d< real64 const > const & values );
 
+    /**
+     * @brief Find the index of the upper vertex of the axis interval containing a coordinate.
+     * @param[in] dim the table axis
+     * @param[in] x the coordinate, assumed to be strictly between the first and last vertices of the axis
+     * @return the index of the first vertex greater than or equal to @p x
+     * @note On evenly spaced axes (the common case for PVT tables), the interval is computed directly
+     *       instead of with a binary search, which keeps the lookup short and branch-free.
+     */
+    GEOSX_HOST_DEVICE
+    localIndex findUpperVertex( integer const dim, real64 const x ) const;
+
     /**
      * @brief Interpolate in the table using linear method.
      * @param[in] input vector of input value
@@ -178,6 +192,9 @@ private:
     /// An array of table axes
     ArrayOfArraysView< real64 const > m_coordinates;
 
+    /// Inverse of the spacing of each table axis (zero if the axis is not evenly spaced)
+    arrayView1d< real64 const > m_coordinateInvSpacing;
+
     /// Table values (in fortran order)
     arrayView1d< real64 const > m_values;
   };
@@ -308,6 +325,7 @@ private:
    * @param[in] target The place to store values.
    * @param[in] filename The name of the file to read.
    * @param[in] delimiter The delimiter used for file entries.
+   * @note This is a collective call: the file is read on rank 0 and its contents are broadcast.
    */
   template< typename T >
   void parseFile( string const & filename, array1d< T > & target );
@@ -327,6 +345,9 @@ private:
   /// An array of table axes
   ArrayOfArrays< real64 > m_coordinates;
 
+  /// Inverse of the spacing of each table axis (zero if the axis is not evenly spaced)
+  array1d< real64 > m_coordinateInvSpacing;
+
   /// Table values (in fortran order)
   array1d< real64 > m_values;
 
@@ -350,6 +371,32 @@ TableFunction::KernelWrapper::compute( IN_ARRAY const & input ) const
   }
 }
 
+GEOSX_HOST_DEVICE
+inline
+localIndex
+TableFunction::KernelWrapper::findUpperVertex( integer const dim, real64 const x ) const
+{
+  arraySlice1d< real64 const > const coords = m_coordinates[dim];
+  real64 const invSpacing = ( dim < m_coordinateInvSpacing.size() ) ? m_coordinateInvSpacing[dim] : 0.0;
+  if( invSpacing > 0.0 )
+  {
+    localIndex const last = coords.size() - 1;
+    localIndex upper = static_cast< localIndex >( ( x - coords[0] ) * invSpacing ) + 1;
+    upper = LvArray::math::min( LvArray::math::max( upper, localIndex( 1 ) ), last );
+    // correct for round-off so that the result is the same as with the binary search
+    if( upper > 1 && x <= coords[upper - 1] )
+    {
+      --upper;
+    }
+    else if( upper < last && x > coords[upper] )
+    {
+      ++upper;
+    }
+    return upper;
+  }
+  return LvArray::integerConversion< localIndex >( LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), x ) );
+}
+
 template< typename IN_ARRAY >
 GEOSX_HOST_DEVICE
 real64
@@ -382,11 +429,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
     else
     {
       // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
+      bounds[dim][1] = findUpperVertex( dim, input[dim] );
       bounds[dim][0] = bounds[dim][1] - 1;
 
       real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
@@ -451,8 +494,7 @@ TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
     {
       // Coordinate is within the table axis
       // Note: find() will return the index of the upper table vertex
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      subIndex = LvArray::integerConversion< localIndex >( lower );
+      subIndex = findUpperVertex( dim, input[dim] );
 
       // Interpolation types:
       //   - Nearest returns the value of the closest table vertex
@@ -538,11 +580,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
     else
     {
       // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
+      bounds[dim][1] = findUpperVertex( dim, input[dim] );
       bounds[dim][0] = bounds[dim][1] - 1;
 
       real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
@@ -989,6 +989,12 @@ void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
     }
   }
 
+  // The local nonzeros are indexed with localIndex, which may be a 32-bit type (see GEOSX_ENABLE_32BIT_LOCALINDEX)
+  globalIndex const numLocalNonZeros = std::accumulate( rowSizes.begin(), rowSizes.end(), globalIndex( 0 ) );
+  GEOSX_ERROR_IF( numLocalNonZeros > LOCALINDEX_MAX,
+                  "The number of local nonzeros (" << numLocalNonZeros << ") exceeds the capacity of localIndex, "
+                  "use more MPI ranks or a 64-bit localIndex" );
+
   // Step 2. Allocate enough capacity for all nonzero entries in each row
   pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalRows, numGlobalDofs(), rowSizes.data() );
 
@@ -201,6 +201,11 @@ void GeosxState::run()
   if( !getProblemManager().runSimulation() )
   {
     m_state = State::COMPLETED;
+    if( m_commandLineOptions->memoryReport )
+    {
+      getProblemManager().printMemoryAllocation();
+      getProblemManager().reportLazyAllocations();
+    }
   }
 }
 
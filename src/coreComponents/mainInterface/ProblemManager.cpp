@@ -20,6 +20,7 @@
 #include "initialization.hpp"
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/MpiWrapper.hpp"
 #include "common/Path.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
@@ -46,6 +47,9 @@
 #include "schema/schemaUtilities.hpp"
 
 // System includes
+#include <exception>
+#include <map>
+#include <sstream>
 #include <vector>
 #include <regex>
 
@@ -371,17 +375,45 @@ void ProblemManager::parseInputFile()
   Group & commandLine = getGroup( groupKeys.commandLine );
   string const & inputFileName = commandLine.getReference< string >( viewKeys.inputFileName );
 
-  // Load preprocessed xml file
-  xmlWrapper::xmlDocument xmlDocument;
-  xmlWrapper::xmlResult const xmlResult = xmlDocument.load_file( inputFileName.c_str() );
-  GEOSX_THROW_IF( !xmlResult, GEOSX_FMT( "Errors found while parsing XML file {}\nDescription: {}\nOffset: {}",
-                                         inputFileName, xmlResult.description(), xmlResult.offset ), InputError );
+  // Only rank 0 reads the input file and its included files, the other ranks receive the resolved document.
+  // This avoids having all the ranks open the same files at once on the shared file system.
+  string xmlString;
+  std::exception_ptr readError;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    try
+    {
+      // Load preprocessed xml file
+      xmlWrapper::xmlDocument xmlDocument;
+      xmlWrapper::xmlResult const xmlResult = xmlDocument.load_file( inputFileName.c_str() );
+      GEOSX_THROW_IF( !xmlResult, GEOSX_FMT( "Errors found while parsing XML file {}\nDescription: {}\nOffset: {}",
+                                             inputFileName, xmlResult.description(), xmlResult.offset ), InputError );
+
+      // Add path information to the file
+      xmlDocument.append_child( xmlWrapper::filePathString ).append_attribute( xmlWrapper::filePathString ).set_value( inputFileName.c_str() );
+
+      // Merge the included files, the imported nodes keep the path of their file to resolve the relative paths
+      xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( this->getName().c_str() );
+      xmlWrapper::addIncludedXMLRecursive( xmlProblemNode );
+
+      std::ostringstream xmlStream;
+      xmlDocument.save( xmlStream, "", pugi::format_raw );
+      xmlString = xmlStream.str();
+    }
+    catch( ... )
+    {
+      readError = std::current_exception();
+    }
+  }
 
-  // Add path information to the file
-  xmlDocument.append_child( xmlWrapper::filePathString ).append_attribute( xmlWrapper::filePathString ).set_value( inputFileName.c_str() );
+  MpiWrapper::broadcast( xmlString, 0 );
+  if( readError )
+  {
+    std::rethrow_exception( readError );
+  }
+  GEOSX_THROW_IF( xmlString.empty(), GEOSX_FMT( "Errors found on rank 0 while reading XML file {}", inputFileName ), InputError );
 
-  // Parse the results
-  parseXMLDocument( xmlDocument );
+  parseInputString( xmlString );
 }
 
 
@@ -807,6 +839,41 @@ bool ProblemManager::runSimulation()
   return m_eventManager->run( getDomainPartition() );
 }
 
+void ProblemManager::reportLazyAllocations() const
+{
+  std::map< string, localIndex > deferredBytes;
+  getDomainPartition().getDeferredAllocations( deferredBytes );
+
+  // the fields are registered identically on all ranks, the ones of rank 0 are reported
+  string reportedNames;
+  for( auto const & nameAndBytes : deferredBytes )
+  {
+    reportedNames += nameAndBytes.first + '\n';
+  }
+  MpiWrapper::broadcast( reportedNames, 0, MPI_COMM_GEOSX );
+  if( reportedNames.empty() )
+  {
+    return;
+  }
+
+  std::vector< string > names;
+  std::vector< real64 > megaBytes;
+  for( std::size_t first = 0, last = reportedNames.find( '\n' ); last != string::npos; first = last + 1, last = reportedNames.find( '\n', first ) )
+  {
+    names.emplace_back( reportedNames.substr( first, last - first ) );
+    auto const it = deferredBytes.find( names.back() );
+    megaBytes.emplace_back( it != deferredBytes.end() ? it->second / ( 1024.0 * 1024.0 ) : 0.0 );
+  }
+  int const numNames = LvArray::integerConversion< int >( names.size() );
+  MpiWrapper::allReduce( megaBytes.data(), megaBytes.data(), numNames, MPI_SUM, MPI_COMM_GEOSX );
+
+  GEOSX_LOG_RANK_0( "\nLazily allocated fields (MB left unallocated, summed over the ranks):" );
+  for( int i = 0; i < numNames; ++i )
+  {
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "  {:<40}  {:>12.1f}", names[i], megaBytes[i] ) );
+  }
+}
+
 DomainPartition & ProblemManager::getDomainPartition()
 {
   return getGroup< DomainPartition >( keys::domain );
@@ -104,7 +104,9 @@ public:
 
   /**
    * @brief Parses the input xml file
-   * @details The name of the input file is indicated via the -i option on the command line
+   * @details The name of the input file is indicated via the -i option on the command line.
+   * The file and its included files are read on rank 0 only, the resolved document is then
+   * broadcast to the other ranks. This is a collective call.
    */
   void parseInputFile();
 
@@ -154,6 +156,12 @@ public:
    */
   bool runSimulation();
 
+  /**
+   * @brief Log the storage left unallocated by the lazily allocated fields, summed over the ranks.
+   * @note This function is collective over MPI_COMM_GEOSX; it is only called with --memory-report.
+   */
+  void reportLazyAllocations() const;
+
   /**
    * @brief After initialization, overwrites data using a restart file
    */
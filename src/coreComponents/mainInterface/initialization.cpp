@@ -100,6 +100,7 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     TIMERS,
     SUPPRESS_MOVE_LOGGING,
     PAUSE_FOR,
+    MEMORY_REPORT,
   };
 
   const option::Descriptor usage[] =
@@ -116,9 +117,10 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     { PROBLEMNAME, 0, "n", "name", Arg::nonEmpty, "\t-n, --name, \t Name of the problem, used for output" },
     { SUPPRESS_PINNED, 0, "s", "suppress-pinned", Arg::None, "\t-s, --suppress-pinned \t Suppress usage of pinned memory for MPI communication buffers" },
     { OUTPUTDIR, 0, "o", "output", Arg::nonEmpty, "\t-o, --output, \t Directory to put the output files" },
-    { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output." },
+    { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output (also prints the built-in timers report at the end of a successful run)." },
     { SUPPRESS_MOVE_LOGGING, 0, "", "suppress-move-logging", Arg::None, "\t--suppress-move-logging \t Suppress logging of host-device data migration" },
     { PAUSE_FOR, 0, "", "pause-for", Arg::numeric, "\t--pause-for, \t Pause geosx for a given number of seconds before starting execution" },
+    { MEMORY_REPORT, 0, "", "memory-report", Arg::None, "\t--memory-report \t Print the memory allocated at the end of the run, and on the ranks receiving SIGUSR1" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -220,6 +222,12 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         commandLineOptions->suppressMoveLogging = true;
       }
       break;
+      case MEMORY_REPORT:
+      {
+        commandLineOptions->memoryReport = true;
+        setupMemoryReportSignal();
+      }
+      break;
       case PAUSE_FOR:
       {
         // we should store this in commandLineOptions and sleep in main
@@ -76,21 +76,21 @@ void EdgeManager::buildSets( NodeManager const & nodeManager )
 
   // Make sets from node sets.
   auto const & nodeSets = nodeManager.sets().wrappers();
-  for( int i = 0; i < nodeSets.size(); ++i )
+  for( localIndex i = 0; i < nodeSets.size(); ++i )
   {
     auto const & setWrapper = nodeSets[i];
     string const & setName = setWrapper->getName();
     createSet( setName );
   }
 
-  // Then loop over them in parallel.
-  forAll< parallelHostPolicy >( nodeSets.size(), [&]( localIndex const i ) -> void
+  // Then fill them in, the edges of each set being tested in parallel.
+  for( localIndex i = 0; i < nodeSets.size(); ++i )
   {
     auto const & setWrapper = nodeSets[i];
     string const & setName = setWrapper->getName();
     SortedArrayView< localIndex const > const targetSet = nodeManager.sets().getReference< SortedArray< localIndex > >( setName ).toViewConst();
     constructSetFromSetAndMap( targetSet, m_toNodesRelation, setName );
-  } );
+  }
 }
 
 void EdgeManager::buildEdges( localIndex const numNodes,
@@ -23,6 +23,7 @@
 #include "FaceManager.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "mesh/MeshManager.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "schema/schemaUtilities.hpp"
 
 namespace geosx
@@ -142,6 +143,9 @@ void ElementRegionManager::generateWells( MeshManager & meshManager,
   globalIndex wellElemCount = 0;
   globalIndex wellNodeCount = 0;
 
+  // index the reservoir elements once, to locate the perforations and well elements of all the wells
+  ElementSpatialIndex const reservoirElemIndex( meshLevel );
+
   // construct the wells one by one
   forElementRegions< WellElementRegion >( [&]( WellElementRegion & wellRegion )
   {
@@ -154,7 +158,7 @@ void ElementRegionManager::generateWells( MeshManager & meshManager,
     // generate the local data (well elements, nodes, perforations) on this well
     // note: each MPI rank knows the global info on the entire well (constructed earlier in InternalWellGenerator)
     // so we only need node and element offsets to construct the local-to-global maps in each wellElemSubRegion
-    wellRegion.generateWell( meshLevel, wellGeometry, nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
+    wellRegion.generateWell( meshLevel, reservoirElemIndex, wellGeometry, nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
 
     // increment counters with global number of nodes and elements
     wellElemCount += wellGeometry.getNumElements();
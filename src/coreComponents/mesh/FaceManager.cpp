@@ -169,14 +169,14 @@ void FaceManager::buildSets( NodeManager const & nodeManager )
     createSet( setName );
   }
 
-  // Then loop over them in parallel and fill them in.
-  forAll< parallelHostPolicy >( nodeSets.size(), [&]( localIndex const i ) -> void
+  // Then fill them in, the faces of each set being tested in parallel.
+  for( localIndex i = 0; i < nodeSets.size(); ++i )
   {
     auto const & setWrapper = nodeSets[i];
     string const & setName = setWrapper->getName();
     SortedArrayView< localIndex const > const & targetSet = nodeManager.sets().getReference< SortedArray< localIndex > >( setName ).toViewConst();
     constructSetFromSetAndMap( targetSet, m_nodeList.toViewConst(), setName );
-  } );
+  }
 }
 
 void FaceManager::setDomainBoundaryObjects()
@@ -23,6 +23,9 @@
 #include "BufferOps.hpp"
 #include "common/TimingMacros.hpp"
 #include "ElementRegionManager.hpp"
+#include "mesh/utilities/BoundingBoxIndex.hpp"
+
+#include <algorithm>
 
 namespace geosx
 {
@@ -226,6 +229,8 @@ void NodeManager::buildRegionMaps( ElementRegionManager const & elementRegionMan
 void NodeManager::buildSets( CellBlockManagerABC const & cellBlockManager,
                              GeometricObjectManager const & geometries )
 {
+  GEOSX_MARK_FUNCTION;
+
   // Let's first copy the sets from the cell block manager.
   for( const auto & nameArray: cellBlockManager.getNodeSets() )
   {
@@ -235,21 +240,49 @@ void NodeManager::buildSets( CellBlockManagerABC const & cellBlockManager,
 
   // Now let's copy them from the geometric objects.
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = this->referencePosition();
-  localIndex const numNodes = this->size();
+  if( geometries.numSubGroups() == 0 )
+  {
+    return;
+  }
+
+  // Index the nodes as degenerate boxes, so that only the nodes close to each object are tested
+  array2d< real64 > nodeBoxMin( X.size( 0 ), 3 );
+  forAll< parallelHostPolicy >( X.size( 0 ), [&]( localIndex const a )
+  {
+    LvArray::tensorOps::copy< 3 >( nodeBoxMin[a], X[a] );
+  } );
+  array2d< real64 > nodeBoxMax = nodeBoxMin;
+  BoundingBoxIndex const nodeIndex( std::move( nodeBoxMin ), std::move( nodeBoxMax ) );
+  array1d< localIndex > candidates;
 
   geometries.forSubGroups< SimpleGeometricObjectBase >(
     [&]( SimpleGeometricObjectBase const & object ) -> void
   {
     string const & name = object.getName();
     SortedArray< localIndex > & targetSet = m_sets.registerWrapper< SortedArray< localIndex > >( name ).reference();
-    for( localIndex a = 0; a < numNodes; ++a )
+
+    // Only test the nodes in the bounding box of the object
+    real64 boxMin[3], boxMax[3];
+    object.getBoundingBox( boxMin, boxMax );
+    candidates.clear();
+    nodeIndex.forBoxesIntersectingBox( boxMin, boxMax, [&]( localIndex const a )
+    {
+      candidates.emplace_back( a );
+    } );
+
+    forAll< parallelHostPolicy >( candidates.size(), [&]( localIndex const i )
     {
-      real64 nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[a] );
-      if( object.isCoordInObject( nodeCoord ) )
+      real64 nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[candidates[i]] );
+      if( !object.isCoordInObject( nodeCoord ) )
       {
-        targetSet.insert( a );
+        candidates[i] = -1;
       }
-    }
+    } );
+
+    // Insert all the nodes of the object at once
+    localIndex * const candidatesEnd = std::remove( candidates.begin(), candidates.end(), -1 );
+    localIndex const numNodesInObject = LvArray::sortedArrayManipulation::makeSortedUnique( candidates.begin(), candidatesEnd );
+    targetSet.insert( candidates.begin(), candidates.begin() + numNodesInObject );
   } );
 }
 
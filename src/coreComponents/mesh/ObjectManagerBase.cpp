@@ -74,6 +74,37 @@ void ObjectManagerBase::createSet( const string & newSetName )
   m_sets.registerWrapper< SortedArray< localIndex > >( newSetName );
 }
 
+namespace
+{
+
+/**
+ * @brief Fill a set with the objects satisfying a predicate.
+ * @tparam PREDICATE the type of the predicate
+ * @param[in] numObjects the number of objects
+ * @param[in] isInSet the predicate, called as isInSet( ka ) concurrently on the objects
+ * @param[out] newset the set, which must be empty
+ *
+ * The objects are tested in parallel, and the selected ones are inserted all at once
+ * rather than one by one.
+ */
+template< typename PREDICATE >
+void fillSet( localIndex const numObjects,
+              PREDICATE && isInSet,
+              SortedArray< localIndex > & newset )
+{
+  array1d< localIndex > selected( numObjects );
+  forAll< parallelHostPolicy >( numObjects, [&]( localIndex const ka )
+  {
+    selected[ka] = isInSet( ka ) ? ka : -1;
+  } );
+
+  // the selected objects are already sorted and unique
+  localIndex * const selectedEnd = std::remove( selected.begin(), selected.end(), -1 );
+  newset.insert( selected.begin(), selectedEnd );
+}
+
+}
+
 void ObjectManagerBase::constructSetFromSetAndMap( SortedArrayView< localIndex const > const & inputSet,
                                                    const array2d< localIndex > & map,
                                                    const string & setName )
@@ -86,23 +117,15 @@ void ObjectManagerBase::constructSetFromSetAndMap( SortedArrayView< localIndex c
 
   if( setName == "all" )
   {
-    newset.reserve( numObjects );
-
-    for( localIndex ka=0; ka<numObjects; ++ka )
-    {
-      newset.insert( ka );
-    }
+    fillSet( numObjects, []( localIndex const ) { return true; }, newset );
   }
   else
   {
     localIndex const mapSize = map.size( 1 );
-    for( localIndex ka=0; ka<numObjects; ++ka )
+    fillSet( numObjects, [&]( localIndex const ka )
     {
-      if( std::all_of( &map( ka, 0 ), &map( ka, 0 ) + mapSize, [&]( localIndex const i ) { return inputSet.contains( i ); } ) )
-      {
-        newset.insert( ka );
-      }
-    }
+      return std::all_of( &map( ka, 0 ), &map( ka, 0 ) + mapSize, [&]( localIndex const i ) { return inputSet.contains( i ); } );
+    }, newset );
   }
 }
 
@@ -118,22 +141,14 @@ void ObjectManagerBase::constructSetFromSetAndMap( SortedArrayView< localIndex c
 
   if( setName == "all" )
   {
-    newset.reserve( numObjects );
-
-    for( localIndex ka=0; ka<numObjects; ++ka )
-    {
-      newset.insert( ka );
-    }
+    fillSet( numObjects, []( localIndex const ) { return true; }, newset );
   }
   else
   {
-    for( localIndex ka=0; ka<numObjects; ++ka )
+    fillSet( numObjects, [&]( localIndex const ka )
     {
-      if( std::all_of( map[ka].begin(), map[ka].end(), [&]( localIndex const i ) { return inputSet.contains( i ); } ) )
-      {
-        newset.insert( ka );
-      }
-    }
+      return std::all_of( map[ka].begin(), map[ka].end(), [&]( localIndex const i ) { return inputSet.contains( i ); } );
+    }, newset );
   }
 }
 
@@ -149,24 +164,16 @@ void ObjectManagerBase::constructSetFromSetAndMap( SortedArrayView< localIndex c
 
   if( setName == "all" )
   {
-    newset.reserve( numObjects );
-
-    for( localIndex ka=0; ka<numObjects; ++ka )
-    {
-      newset.insert( ka );
-    }
+    fillSet( numObjects, []( localIndex const ) { return true; }, newset );
   }
   else
   {
-    for( localIndex ka=0; ka<numObjects; ++ka )
+    fillSet( numObjects, [&]( localIndex const ka )
     {
       localIndex const * const values = map[ka];
       localIndex const numValues = map.sizeOfArray( ka );
-      if( std::all_of( values, values + numValues, [&]( localIndex const i ) { return inputSet.contains( i ); } ) )
-      {
-        newset.insert( ka );
-      }
-    }
+      return std::all_of( values, values + numValues, [&]( localIndex const i ) { return inputSet.contains( i ); } );
+    }, newset );
   }
 }
 
@@ -286,7 +293,9 @@ localIndex ObjectManagerBase::packPrivate( buffer_unit_type * & buffer,
     packedSize += bufferOps::Pack< DOPACK >( buffer, wrapperNamesForPacking.size() );
     for( auto const & wrapperName : wrapperNamesForPacking )
     {
-      if( this->hasWrapper( wrapperName ) )
+      // a lazily allocated wrapper that was never written to has no storage to pack: the field synchronizations
+      // allocate it beforehand if any rank has written to it (see CommunicationTools::synchronizePackSendRecvSizes)
+      if( this->hasWrapper( wrapperName ) && this->getWrapperBase( wrapperName ).isAllocated() )
       {
         dataRepository::WrapperBase const & wrapper = this->getWrapperBase( wrapperName );
         packedSize += bufferOps::Pack< DOPACK >( buffer, wrapperName );
@@ -617,7 +617,9 @@ public:
   template< typename MESH_DATA_TRAIT >
   GEOSX_DECLTYPE_AUTO_RETURN getExtrinsicData() const
   {
-    return this->getWrapper< typename MESH_DATA_TRAIT::type >( MESH_DATA_TRAIT::key() ).reference();
+    // the key of the trait is hashed at compile time
+    constexpr dataRepository::HashedKey key( MESH_DATA_TRAIT::key() );
+    return this->getWrapper< typename MESH_DATA_TRAIT::type >( key ).reference();
   }
 
   /**
@@ -629,7 +631,9 @@ public:
   template< typename MESH_DATA_TRAIT >
   GEOSX_DECLTYPE_AUTO_RETURN getExtrinsicData()
   {
-    return this->getWrapper< typename MESH_DATA_TRAIT::type >( MESH_DATA_TRAIT::key() ).reference();
+    // the key of the trait is hashed at compile time
+    constexpr dataRepository::HashedKey key( MESH_DATA_TRAIT::key() );
+    return this->getWrapper< typename MESH_DATA_TRAIT::type >( key ).reference();
   }
 
   /**
@@ -641,7 +645,8 @@ public:
   template< typename MESH_DATA_TRAIT >
   bool hasExtrinsicData() const
   {
-    return this->hasWrapper( MESH_DATA_TRAIT::key() );
+    constexpr dataRepository::HashedKey key( MESH_DATA_TRAIT::key() );
+    return this->hasWrapper( key );
   }
 
 #if 0
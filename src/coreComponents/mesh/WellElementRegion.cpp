@@ -43,6 +43,7 @@ WellElementRegion::~WellElementRegion()
 
 
 void WellElementRegion::generateWell( MeshLevel & mesh,
+                                      ElementSpatialIndex const & reservoirElemIndex,
                                       InternalWellGenerator const & wellGeometry,
                                       globalIndex nodeOffsetGlobal,
                                       globalIndex elemOffsetGlobal )
@@ -61,7 +62,7 @@ void WellElementRegion::generateWell( MeshLevel & mesh,
   globalIndex const numPerforationsGlobal = wellGeometry.getNumPerforations();
 
   // 1) select the local perforations based on connectivity to the local reservoir elements
-  subRegion.connectPerforationsToMeshElements( mesh, wellGeometry );
+  subRegion.connectPerforationsToMeshElements( mesh, reservoirElemIndex, wellGeometry );
 
   globalIndex const matchedPerforations = MpiWrapper::sum( perforationData->size() );
   GEOSX_THROW_IF( matchedPerforations != numPerforationsGlobal,
@@ -98,6 +99,7 @@ void WellElementRegion::generateWell( MeshLevel & mesh,
 
   // 3) select the local well elements and mark boundary nodes (for ghosting)
   subRegion.generate( mesh,
+                      reservoirElemIndex,
                       wellGeometry,
                       elemStatusGlobal,
                       nodeOffsetGlobal,
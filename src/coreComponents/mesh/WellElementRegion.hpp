@@ -26,6 +26,7 @@
 namespace geosx
 {
 
+class ElementSpatialIndex;
 class MeshLevel;
 
 /**
@@ -126,11 +127,13 @@ public:
   /**
    * @brief Build the local well elements and perforations from global well geometry.
    * @param[in] mesh the mesh object (single level only)
+   * @param[in] reservoirElemIndex the spatial index of the reservoir elements of @p mesh
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
    * @param[in] nodeOffsetGlobal the offset of the first global well node ( = offset of last global mesh node + 1 )
    * @param[in] elemOffsetGlobal the offset of the first global well element ( = offset of last global mesh elem + 1 )
    */
   void generateWell( MeshLevel & mesh,
+                     ElementSpatialIndex const & reservoirElemIndex,
                      InternalWellGenerator const & wellGeometry,
                      globalIndex nodeOffsetGlobal,
                      globalIndex elemOffsetGlobal );
@@ -16,7 +16,7 @@
 
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "common/MpiWrapper.hpp"
 #include "LvArray/src/output.hpp"
 
@@ -261,37 +261,49 @@ bool visitNeighborElements( MeshLevel const & mesh,
           Note that this reservoir element does not necessarily contain the center of the well element.
           This "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
           contains the well element.
+          Only the reservoir elements whose bounding box contains "location" are considered: if there is none,
+          "location" is outside of the local reservoir elements and the search can be skipped.
  * @param[in] meshLevel the mesh object (single level only)
+ * @param[in] reservoirElemIndex the spatial index of the reservoir elements of @p mesh
  * @param[in] location the location of that we are trying to match with a reservoir element
  * @param[inout] erInit the region index of the reservoir element from which we start the search
  * @param[inout] esrInit the subregion index of the reservoir element from which we start the search
  * @param[inout] eiInit the element index of the reservoir element from which we start the search
+ * @return true if a reservoir element was found to start the search
  */
-void initializeLocalSearch( MeshLevel const & mesh,
+bool initializeLocalSearch( MeshLevel const & mesh,
+                            ElementSpatialIndex const & reservoirElemIndex,
                             R1Tensor const & location,
                             localIndex & erInit,
                             localIndex & esrInit,
                             localIndex & eiInit )
 {
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
-  resElemCenter = mesh.getElemManager().constructViewAccessor< array2d< real64 >,
-                                                               arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
   // to initialize the local search for the reservoir element that contains "location",
   // we find the reservoir element that minimizes the distance from "location" to the reservoir element center
-  auto ret = minLocOverElemsInMesh( mesh, [&] ( localIndex const er,
-                                                localIndex const esr,
-                                                localIndex const ei )
+  real64 minDistance = std::numeric_limits< real64 >::max();
+  reservoirElemIndex.forElementsContainingPoint( location, [&]( localIndex const er,
+                                                                localIndex const esr,
+                                                                localIndex const ei )
   {
+    CellElementSubRegion const & subRegion = elemManager.getRegion( er ).getSubRegion< CellElementSubRegion >( esr );
     R1Tensor v = location;
-    LvArray::tensorOps::subtract< 3 >( v, resElemCenter[er][esr][ei] );
-    return LvArray::tensorOps::l2Norm< 3 >( v );
+    LvArray::tensorOps::subtract< 3 >( v, subRegion.getElementCenter()[ei] );
+    real64 const distance = LvArray::tensorOps::l2Norm< 3 >( v );
+    if( distance < minDistance )
+    {
+      minDistance = distance;
+
+      // save the region, subregion and index of the reservoir element
+      // note that this reservoir element does not necessarily contains "location"
+      erInit  = er;
+      esrInit = esr;
+      eiInit  = ei;
+    }
   } );
 
-  // save the region, subregion and index of the reservoir element
-  // note that this reservoir element does not necessarily contains "location"
-  erInit  = std::get< 0 >( ret.second );
-  esrInit = std::get< 1 >( ret.second );
-  eiInit  = std::get< 2 >( ret.second );
+  return eiInit >= 0;
 }
 
 /**
@@ -359,6 +371,7 @@ bool searchLocalElements( MeshLevel const & mesh,
 }
 
 void WellElementSubRegion::generate( MeshLevel & mesh,
+                                     ElementSpatialIndex const & reservoirElemIndex,
                                      InternalWellGenerator const & wellGeometry,
                                      arrayView1d< integer > & elemStatusGlobal,
                                      globalIndex nodeOffsetGlobal,
@@ -399,6 +412,7 @@ void WellElementSubRegion::generate( MeshLevel & mesh,
   //      ie., if the center of the well element falls in the domain owned by rank k
   //      then the well element is assigned to rank k
   assignUnownedElementsInReservoir( mesh,
+                                    reservoirElemIndex,
                                     wellGeometry,
                                     unownedElems,
                                     localElems,
@@ -451,6 +465,7 @@ void WellElementSubRegion::generate( MeshLevel & mesh,
 
 
 void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
+                                                             ElementSpatialIndex const & reservoirElemIndex,
                                                              InternalWellGenerator const & wellGeometry,
                                                              SortedArray< globalIndex >      const & unownedElems,
                                                              SortedArray< globalIndex > & localElems,
@@ -482,14 +497,15 @@ void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
     //         note that this reservoir element does not necessarily contain the center of the well element
     //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
     //         contains the well element
-    initializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
+    bool const resElemInitFound = initializeLocalSearch( mesh, reservoirElemIndex, location,
+                                                         erInit, esrInit, eiInit );
 
     // Step 2: then, search for the reservoir element that contains the well element
     //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = searchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    bool const resElemFound = resElemInitFound &&
+                              searchLocalElements( mesh, location, m_searchDepth,
+                                                   erInit, esrInit, eiInit,
+                                                   erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
@@ -766,6 +782,7 @@ void WellElementSubRegion::updateNodeManagerNodeToElementMap( MeshLevel & mesh )
 }
 
 void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
+                                                              ElementSpatialIndex const & reservoirElemIndex,
                                                               InternalWellGenerator const & wellGeometry )
 {
   arrayView2d< real64 const > const perfCoordsGlobal = wellGeometry.getPerfCoords();
@@ -795,14 +812,15 @@ void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
     //         note that this reservoir element does not necessarily contain the center of the well element
     //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
     //         contains the well element
-    initializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
+    bool const resElemInitFound = initializeLocalSearch( mesh, reservoirElemIndex, location,
+                                                         erInit, esrInit, eiInit );
 
     // Step 2: then, search for the reservoir element that contains the well element
     //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = searchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    bool const resElemFound = resElemInitFound &&
+                              searchLocalElements( mesh, location, m_searchDepth,
+                                                   erInit, esrInit, eiInit,
+                                                   erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
@@ -22,6 +22,8 @@
 namespace geosx
 {
 
+class ElementSpatialIndex;
+
 /**
  * @class WellElementSubRegion
  * @brief This class describes a collection of local well elements and perforations.
@@ -224,6 +226,7 @@ public:
   /**
    * @brief Build the local well elements from global well element data.
    * @param[in] mesh the mesh object (single level only)
+   * @param[in] reservoirElemIndex the spatial index of the reservoir elements of @p mesh
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
    * @param[in] elemStatus list of well element status, as determined by perforations connected
    *                       to local or remote mesh partitions. Status values are defined in
@@ -232,6 +235,7 @@ public:
    * @param[in] elemOffsetGlobal the offset of the first global well element ( = offset of last global mesh elem + 1 )
    */
   void generate( MeshLevel & mesh,
+                 ElementSpatialIndex const & reservoirElemIndex,
                  InternalWellGenerator const & wellGeometry,
                  arrayView1d< integer > & elemStatus,
                  globalIndex nodeOffsetGlobal,
@@ -240,9 +244,11 @@ public:
   /**
    * @brief For each perforation, find the reservoir element that contains the perforation.
    * @param[in] mesh the mesh object (single level only)
+   * @param[in] reservoirElemIndex the spatial index of the reservoir elements of @p mesh
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
    */
   void connectPerforationsToMeshElements( MeshLevel & mesh,
+                                          ElementSpatialIndex const & reservoirElemIndex,
                                           InternalWellGenerator const & wellGeometry );
 
   /**
@@ -343,6 +349,7 @@ private:
    * @brief Assign the unowned well elements (= well elem without perforation ) that are
             in the reservoir (and that can therefore be matched with a reservoir element) to an MPI rank.
    * @param[in] meshLevel the mesh object (single level only)
+   * @param[in] reservoirElemIndex the spatial index of the reservoir elements of @p mesh
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
    * @param[in] unownedElems set of unowned well elems.
    * @param[out] localElems set of local well elems. It contains the perforated well elements
@@ -352,6 +359,7 @@ private:
    *                            enum SegmentStatus. They are used to partition well elements.
    */
   void assignUnownedElementsInReservoir( MeshLevel & mesh,
+                                         ElementSpatialIndex const & reservoirElemIndex,
                                          InternalWellGenerator const & wellGeometry,
                                          SortedArray< globalIndex >           const & unownedElems,
                                          SortedArray< globalIndex > & localElems,
@@ -90,4 +90,11 @@ void CellBlock::getFaceNodes( localIndex iElement,
   geosx::getFaceNodes( m_elementType, iElement, iFace, m_elementsToNodes, nodesInFaces );
 }
 
+localIndex CellBlock::getFaceNodes( localIndex iElement,
+                                    localIndex iFace,
+                                    localIndex * const nodesInFace ) const
+{
+  return geosx::getFaceNodes( m_elementType, iElement, iFace, m_elementsToNodes, nodesInFace );
+}
+
 }
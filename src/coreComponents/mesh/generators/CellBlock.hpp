@@ -106,6 +106,17 @@ public:
                      localIndex iFace,
                      array1d< localIndex > & nodesInFaces ) const;
 
+  /**
+   * @brief Puts the nodes of face @p iFace of element @p iElement inside the buffer @p nodesInFace, without any allocation.
+   * @param[in] iElement The element index.
+   * @param[in] iFace The local face index (not the global index). E.g. an hexahedron have face 6 indices from 0 to 5.
+   * @param[out] nodesInFace Pointer to (at least) maxNodesPerFace() values, filled with the nodes of the face.
+   * @return The number of nodes of the face.
+   */
+  localIndex getFaceNodes( localIndex iElement,
+                           localIndex iFace,
+                           localIndex * const nodesInFace ) const;
+
   /**
    * @brief Get the element to nodes mapping, non-const version.
    * @return The mapping relationship as a array.
@@ -17,6 +17,8 @@
 #include "CellBlockUtilities.hpp"
 
 #include <algorithm>
+#include <numeric>
+#include <tuple>
 
 namespace geosx
 {
@@ -117,14 +119,20 @@ ArrayOfArrays< localIndex > CellBlockManager::getNodeToElements() const
  */
 struct NodesAndElementOfFace
 {
-  NodesAndElementOfFace( array1d< localIndex > nodes_, localIndex element_, localIndex iCellBlock_, localIndex iFace_ ):
-    nodes( nodes_ ),
+  NodesAndElementOfFace( localIndex const * const nodes_,
+                         localIndex const numNodes_,
+                         localIndex element_,
+                         localIndex iCellBlock_,
+                         localIndex iFace_ ):
+    numNodes( numNodes_ ),
     element( element_ ),
     iCellBlock( iCellBlock_ ),
-    iFace( iFace_ ),
-    sortedNodes( nodes_ )
+    iFace( iFace_ )
   {
-    std::sort( sortedNodes.begin(), sortedNodes.end() );
+    GEOSX_ASSERT_GE( maxNodesPerFace(), numNodes );
+    std::copy( nodes_, nodes_ + numNodes, nodes );
+    std::copy( nodes_, nodes_ + numNodes, sortedNodes );
+    std::sort( sortedNodes, sortedNodes + numNodes );
   }
 
   /**
@@ -137,8 +145,8 @@ struct NodesAndElementOfFace
     // Using some standard comparison like vector::operator<.
     // Two subsequent NodesAndElementOfFace may still be equal
     // We are consistent with operator==, which is what we require.
-    return std::lexicographical_compare( sortedNodes.begin(), sortedNodes.end(),
-                                         rhs.sortedNodes.begin(), rhs.sortedNodes.end() );
+    return std::lexicographical_compare( sortedNodes, sortedNodes + numNodes,
+                                         rhs.sortedNodes, rhs.sortedNodes + rhs.numNodes );
   }
 
   /**
@@ -149,11 +157,14 @@ struct NodesAndElementOfFace
   bool operator==( NodesAndElementOfFace const & rhs ) const
   {
     // Comparing term by term like STL does.
-    return ( sortedNodes.size() == rhs.sortedNodes.size() && std::equal( sortedNodes.begin(), sortedNodes.end(), rhs.sortedNodes.begin() ) );
+    return ( numNodes == rhs.numNodes && std::equal( sortedNodes, sortedNodes + numNodes, rhs.sortedNodes ) );
   }
 
-  /// The list of nodes describing the face.
-  array1d< localIndex > nodes;
+  /// The list of nodes describing the face (only the first numNodes values are used).
+  localIndex nodes[ maxNodesPerFace() ];
+
+  /// The number of nodes of the face.
+  localIndex numNodes;
 
   /**
    * @brief The element to which this face belongs.
@@ -181,7 +192,7 @@ struct NodesAndElementOfFace
 
 private:
   /// Sorted nodes describing the face; only for comparison/sorting reasons.
-  array1d< localIndex > sortedNodes;
+  localIndex sortedNodes[ maxNodesPerFace() ];
 };
 
 /**
@@ -234,7 +245,7 @@ void insertFaceToNodesEntry( localIndex const faceID,
                              NodesAndElementOfFace const & nodesAndElementOfFace,
                              ArrayOfArrays< localIndex > & faceToNodes )
 {
-  localIndex const numFaceNodes = nodesAndElementOfFace.nodes.size();
+  localIndex const numFaceNodes = nodesAndElementOfFace.numNodes;
   // FIXME The size should be OK because it's been allocated previously.
   for( localIndex i = 0; i < numFaceNodes; ++i )
   {
@@ -323,7 +334,7 @@ void resizeFaceMaps( ArrayOfArraysView< NodesAndElementOfFace const > const & lo
     for( localIndex j = 0, curFaceID = uniqueFaceOffsets[ nodeID ]; j < numFaces; ++j, ++curFaceID )
     {
       const NodesAndElementOfFace & f0 = lowestNodeToFaces( nodeID, j );
-      numNodesPerFace[curFaceID] = f0.nodes.size();
+      numNodesPerFace[curFaceID] = f0.numNodes;
       totalFaceNodes += numNodesPerFace[curFaceID];
 
       if( ( j < numFaces - 1 ) and ( f0 == lowestNodeToFaces( nodeID, j + 1 ) ) )
@@ -363,6 +374,33 @@ void resizeFaceMaps( ArrayOfArraysView< NodesAndElementOfFace const > const & lo
 }
 
 
+/**
+ * @brief Loop over all the faces of all the elements of all the cell blocks, in parallel over the elements.
+ * @tparam LAMBDA The type of the function called on each face.
+ * @param [in] cellBlocks The cell blocks on which we need to operate.
+ * @param [in] lambda The function called as lambda( nodesInFace, numNodesInFace, iElement, iCellBlock, iFace ).
+ */
+template< typename LAMBDA >
+void forAllCellBlockFaces( const Group & cellBlocks, LAMBDA && lambda )
+{
+  for( localIndex iCellBlock = 0; iCellBlock < cellBlocks.numSubGroups(); ++iCellBlock )
+  {
+    const CellBlock & cb = cellBlocks.getGroup< CellBlock >( iCellBlock );
+    localIndex const numFacesPerElement = cb.numFacesPerElement();
+
+    forAll< parallelHostPolicy >( cb.numElements(), [&]( localIndex const iElement )
+    {
+      // Looping on the faces of the cell, the nodes being collected in a fixed size buffer.
+      localIndex nodesInFace[ maxNodesPerFace() ];
+      for( localIndex iFace = 0; iFace < numFacesPerElement; ++iFace )
+      {
+        localIndex const numNodesInFace = cb.getFaceNodes( iElement, iFace, nodesInFace );
+        lambda( nodesInFace, numNodesInFace, iElement, iCellBlock, iFace );
+      }
+    } );
+  }
+}
+
 /**
  * @brief Populate the lowestNodeToFaces map.
  * @param [in] numNodes Number of nodes
@@ -374,39 +412,69 @@ void resizeFaceMaps( ArrayOfArraysView< NodesAndElementOfFace const > const & lo
  * The key of this mapping is the lowest node index of the face.
  * E.g. faces {3, 5, 6, 2} and {4, 2, 9, 7} will both be stored in "bucket" of node 2.
  * Also, bucket of faces information are sorted (@see NodesAndElementOfFace) to make specific computations possible.
+ *
+ * The faces are first counted, so that each bucket is allocated with its exact size,
+ * and then inserted in parallel. The buckets are finally sorted with a deterministic order
+ * (the insertion order of the duplicates is not).
  */
 ArrayOfArrays< NodesAndElementOfFace > createLowestNodeToFaces( localIndex numNodes, const Group & cellBlocks )
 {
-  ArrayOfArrays< NodesAndElementOfFace > lowestNodeToFaces( numNodes, 2 * CellBlockManager::maxFacesPerNode() );
+  GEOSX_MARK_FUNCTION;
 
-  // The function is a bit simplified and is not run in parallel anymore.
-  // Can be improved.
-  for( localIndex iCellBlock = 0; iCellBlock < cellBlocks.numSubGroups(); ++iCellBlock )
+  // First step: how many faces for each lowest node.
+  array1d< localIndex > facesPerNode( numNodes );
+  forAllCellBlockFaces( cellBlocks, [&]( localIndex const * const nodesInFace,
+                                         localIndex const numNodesInFace,
+                                         localIndex,
+                                         localIndex,
+                                         localIndex )
   {
-    const CellBlock & cb = cellBlocks.getGroup< CellBlock >( iCellBlock );
-    localIndex const numFacesPerElement = cb.numFacesPerElement();
-    localIndex const numElements = cb.numElements();
+    localIndex const lowestNode = *std::min_element( nodesInFace, nodesInFace + numNodesInFace );
+    RAJA::atomicInc< parallelHostAtomic >( &facesPerNode[ lowestNode ] );
+  } );
 
-    for( localIndex iElement = 0; iElement < numElements; ++iElement )
+  // Second step: allocation of the buckets.
+  ArrayOfArrays< NodesAndElementOfFace > lowestNodeToFaces;
+  lowestNodeToFaces.reserve( numNodes );
+  lowestNodeToFaces.reserveValues( std::accumulate( facesPerNode.begin(), facesPerNode.end(), localIndex( 0 ) ) );
+  for( localIndex nodeID = 0; nodeID < numNodes; ++nodeID )
+  {
+    lowestNodeToFaces.appendArray( 0 );
+    lowestNodeToFaces.setCapacityOfArray( nodeID, facesPerNode[ nodeID ] );
+  }
+
+  // Third step: filling the buckets.
+  forAllCellBlockFaces( cellBlocks, [&]( localIndex const * const nodesInFace,
+                                         localIndex const numNodesInFace,
+                                         localIndex const iElement,
+                                         localIndex const iCellBlock,
+                                         localIndex const iFace )
+  {
+    localIndex const lowestNode = *std::min_element( nodesInFace, nodesInFace + numNodesInFace );
+    lowestNodeToFaces.emplaceBackAtomic< parallelHostAtomic >( lowestNode, nodesInFace, numNodesInFace, iElement, iCellBlock, iFace );
+  } );
+
+  // The duplicates of a face are ordered by cell block, element and local face index,
+  // so that the face orientation and the face to elements map do not depend on the insertion order.
+  // This comparator is not attached to NodesAndElementOfFace because of potential inconsistencies with operator==
+  auto const comp = []( NodesAndElementOfFace const & f0, NodesAndElementOfFace const & f1 ) -> bool
+  {
+    if( f0 < f1 )
     {
-      // Looping on the faces of the cell
-      for( localIndex iFace = 0; iFace < numFacesPerElement; ++iFace )
-      {
-        // Get all the nodes of the face
-        array1d< localIndex > nodesInFace;
-        cb.getFaceNodes( iElement, iFace, nodesInFace );
-        // Fill the result with the collected data.
-        localIndex const & lowestNode = *std::min_element( nodesInFace.begin(), nodesInFace.end() );
-        lowestNodeToFaces.emplaceBack( lowestNode, nodesInFace, iElement, iCellBlock, iFace );
-      }
+      return true;
     }
-  }
+    if( f1 < f0 )
+    {
+      return false;
+    }
+    return std::make_tuple( f0.iCellBlock, f0.element, f0.iFace ) < std::make_tuple( f1.iCellBlock, f1.element, f1.iFace );
+  };
 
   // Loop over all the nodes and sort the associated faces.
   forAll< parallelHostPolicy >( numNodes, [&]( localIndex const nodeID )
   {
     NodesAndElementOfFace * const faces = lowestNodeToFaces[ nodeID ];
-    std::sort( faces, faces + lowestNodeToFaces.sizeOfArray( nodeID ) );
+    std::sort( faces, faces + lowestNodeToFaces.sizeOfArray( nodeID ), comp );
   } );
 
   return lowestNodeToFaces;
@@ -426,7 +494,8 @@ void fillElementToFacesOfCellBlocks( ArrayOfArrays< NodesAndElementOfFace > cons
                                      Group & cellBlocks )
 {
   localIndex const numNodes = lowestNodeToFaces.size();
-  for( localIndex nodeID = 0; nodeID < numNodes; ++nodeID )
+  // Each (element, local face) pair appears exactly once in all the buckets, so that the nodes can be processed in parallel.
+  forAll< parallelHostPolicy >( numNodes, [&]( localIndex const nodeID )
   {
     localIndex const numFaces = lowestNodeToFaces.sizeOfArray( nodeID );
     for( localIndex j = 0, curFaceID = uniqueFaceOffsets[nodeID]; j < numFaces; ++j, ++curFaceID )
@@ -449,7 +518,7 @@ void fillElementToFacesOfCellBlocks( ArrayOfArrays< NodesAndElementOfFace > cons
         }
       }
     }
-  }
+  } );
 }
 
 /**
@@ -528,14 +597,27 @@ void CellBlockManager::buildFaceMaps()
 
 void CellBlockManager::buildNodeToEdges()
 {
-  ArrayOfArrays< localIndex > toEdgesTemp( m_numNodes, maxEdgesPerNode() );
-  RAJA::ReduceSum< parallelHostReduce, localIndex > totalNodeEdges = 0;
+  // Count the edges of each node first, so that the temporary map is allocated with its exact size.
+  array1d< localIndex > edgesPerNode( m_numNodes );
+  forAll< parallelHostPolicy >( m_numEdges, [&]( localIndex const edgeID )
+  {
+    RAJA::atomicInc< parallelHostAtomic >( &edgesPerNode[ m_edgeToNodes( edgeID, 0 ) ] );
+    RAJA::atomicInc< parallelHostAtomic >( &edgesPerNode[ m_edgeToNodes( edgeID, 1 ) ] );
+  } );
+
+  ArrayOfArrays< localIndex > toEdgesTemp;
+  toEdgesTemp.reserve( m_numNodes );
+  toEdgesTemp.reserveValues( 2 * m_numEdges );
+  for( localIndex nodeID = 0; nodeID < m_numNodes; ++nodeID )
+  {
+    toEdgesTemp.appendArray( 0 );
+    toEdgesTemp.setCapacityOfArray( nodeID, edgesPerNode[ nodeID ] );
+  }
 
   forAll< parallelHostPolicy >( m_numEdges, [&]( localIndex const edgeID )
   {
     toEdgesTemp.emplaceBackAtomic< parallelHostAtomic >( m_edgeToNodes( edgeID, 0 ), edgeID );
     toEdgesTemp.emplaceBackAtomic< parallelHostAtomic >( m_edgeToNodes( edgeID, 1 ), edgeID );
-    totalNodeEdges += 2;
   } );
 
   // Resize the node to edge map.
@@ -547,7 +629,7 @@ void CellBlockManager::buildNodeToEdges()
   m_nodeToEdges.reserve( entriesToReserve );
 
   // Reserve space for the total number of face nodes + extra space for existing faces + even more space for new faces.
-  localIndex const valuesToReserve = totalNodeEdges.get() + m_numNodes * getEdgeMapOverallocation() * ( 1 + 2 * overAllocationFactor );
+  localIndex const valuesToReserve = 2 * m_numEdges + m_numNodes * getEdgeMapOverallocation() * ( 1 + 2 * overAllocationFactor );
   m_nodeToEdges.reserveValues( valuesToReserve );
 
   // Append the individual sets.
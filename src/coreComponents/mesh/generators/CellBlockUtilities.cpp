@@ -19,20 +19,24 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 #include "common/TimingMacros.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace geosx
 {
 
-void getFaceNodes( ElementType const & elementType,
-                   localIndex const iElement,
-                   localIndex const iFace,
-                   array2d< localIndex, cells::NODE_MAP_PERMUTATION > const & elementToNodes,
-                   array1d< localIndex > & nodeIndices )
+localIndex getFaceNodes( ElementType const & elementType,
+                         localIndex const iElement,
+                         localIndex const iFace,
+                         array2d< localIndex, cells::NODE_MAP_PERMUTATION > const & elementToNodes,
+                         localIndex * const nodeIndices )
 {
+  localIndex numFaceNodes = 0;
   switch( elementType )
   {
     case ElementType::Hexahedron:
     {
-      nodeIndices.resize( 4 );
+      numFaceNodes = 4;
       switch( iFace )
       {
         case 0:
@@ -96,7 +100,7 @@ void getFaceNodes( ElementType const & elementType,
       {
         case 0:
         {
-          nodeIndices.resize( 4 );
+          numFaceNodes = 4;
           nodeIndices[0] = elementToNodes[iElement][0];
           nodeIndices[1] = elementToNodes[iElement][1];
           nodeIndices[2] = elementToNodes[iElement][5];
@@ -105,7 +109,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 1:
         {
-          nodeIndices.resize( 4 );
+          numFaceNodes = 4;
           nodeIndices[0] = elementToNodes[iElement][0];
           nodeIndices[1] = elementToNodes[iElement][2];
           nodeIndices[2] = elementToNodes[iElement][3];
@@ -114,7 +118,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 2:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][0];
           nodeIndices[1] = elementToNodes[iElement][2];
           nodeIndices[2] = elementToNodes[iElement][4];
@@ -122,7 +126,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 3:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][1];
           nodeIndices[1] = elementToNodes[iElement][3];
           nodeIndices[2] = elementToNodes[iElement][5];
@@ -130,7 +134,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 4:
         {
-          nodeIndices.resize( 4 );
+          numFaceNodes = 4;
           nodeIndices[0] = elementToNodes[iElement][2];
           nodeIndices[1] = elementToNodes[iElement][3];
           nodeIndices[2] = elementToNodes[iElement][5];
@@ -146,7 +150,7 @@ void getFaceNodes( ElementType const & elementType,
     }
     case ElementType::Tetrahedron:
     {
-      nodeIndices.resize( 3 );
+      numFaceNodes = 3;
       switch( iFace )
       {
         case 0:
@@ -190,7 +194,7 @@ void getFaceNodes( ElementType const & elementType,
       {
         case 0:
         {
-          nodeIndices.resize( 4 );
+          numFaceNodes = 4;
           nodeIndices[0] = elementToNodes[iElement][0];
           nodeIndices[1] = elementToNodes[iElement][1];
           nodeIndices[2] = elementToNodes[iElement][2];
@@ -199,7 +203,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 1:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][0];
           nodeIndices[1] = elementToNodes[iElement][1];
           nodeIndices[2] = elementToNodes[iElement][4];
@@ -207,7 +211,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 2:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][1];
           nodeIndices[1] = elementToNodes[iElement][2];
           nodeIndices[2] = elementToNodes[iElement][4];
@@ -215,7 +219,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 3:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][2];
           nodeIndices[1] = elementToNodes[iElement][3];
           nodeIndices[2] = elementToNodes[iElement][4];
@@ -223,7 +227,7 @@ void getFaceNodes( ElementType const & elementType,
         }
         case 4:
         {
-          nodeIndices.resize( 3 );
+          numFaceNodes = 3;
           nodeIndices[0] = elementToNodes[iElement][3];
           nodeIndices[1] = elementToNodes[iElement][0];
           nodeIndices[2] = elementToNodes[iElement][4];
@@ -241,6 +245,20 @@ void getFaceNodes( ElementType const & elementType,
       GEOSX_ERROR( "Invalid element type: " << elementType );
     }
   }
+  GEOSX_ASSERT_GE( maxNodesPerFace(), numFaceNodes );
+  return numFaceNodes;
+}
+
+void getFaceNodes( ElementType const & elementType,
+                   localIndex const iElement,
+                   localIndex const iFace,
+                   array2d< localIndex, cells::NODE_MAP_PERMUTATION > const & elementToNodes,
+                   array1d< localIndex > & nodeIndices )
+{
+  localIndex faceNodes[ maxNodesPerFace() ];
+  localIndex const numFaceNodes = getFaceNodes( elementType, iElement, iFace, elementToNodes, faceNodes );
+  nodeIndices.resize( numFaceNodes );
+  std::copy( faceNodes, faceNodes + numFaceNodes, nodeIndices.begin() );
 }
 
 /**
@@ -331,16 +349,36 @@ void addEdge( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestNode,
  * For each edge of each face, this function gets the lowest node in the edge n0, creates an EdgeBuilder
  * associated with the edge and then appends the EdgeBuilder to edgesByLowestNode[ n0 ]. Finally it sorts
  * the contents of each sub-array of edgesByLowestNode from least to greatest.
+ * The edges are counted first, so that each sub-array is allocated with its exact size.
  */
 ArrayOfArrays< EdgeBuilder > createEdgesByLowestNode( localIndex numNodes,
                                                       ArrayOfArraysView< localIndex const > const & faceToNodeMap )
 {
   GEOSX_MARK_FUNCTION;
 
-  ArrayOfArrays< EdgeBuilder > edgesByLowestNode( numNodes, 2 * CellBlockManagerABC::maxEdgesPerNode() );
-
   localIndex const numFaces = faceToNodeMap.size();
 
+  // count the edges associated with each lowest node.
+  array1d< localIndex > edgesPerNode( numNodes );
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
+  {
+    localIndex const numNodesInFace = faceToNodeMap.sizeOfArray( faceID );
+    for( localIndex a = 0; a < numNodesInFace; ++a )
+    {
+      localIndex const node0 = std::min( faceToNodeMap( faceID, a ), faceToNodeMap( faceID, ( a + 1 ) % numNodesInFace ) );
+      RAJA::atomicInc< parallelHostAtomic >( &edgesPerNode[ node0 ] );
+    }
+  } );
+
+  ArrayOfArrays< EdgeBuilder > edgesByLowestNode;
+  edgesByLowestNode.reserve( numNodes );
+  edgesByLowestNode.reserveValues( std::accumulate( edgesPerNode.begin(), edgesPerNode.end(), localIndex( 0 ) ) );
+  for( localIndex nodeID = 0; nodeID < numNodes; ++nodeID )
+  {
+    edgesByLowestNode.appendArray( 0 );
+    edgesByLowestNode.setCapacityOfArray( nodeID, edgesPerNode[ nodeID ] );
+  }
+
   // loop over all the faces.
   forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
   {
@@ -36,6 +36,28 @@ localIndex buildEdgeMaps( localIndex numNodes,
                           ArrayOfSets< localIndex > & edgeToFaceMap,
                           array2d< localIndex > & edgeToNodeMap );
 
+/**
+ * @brief Maximum number of nodes in a face, over all the supported element types.
+ * @return The number of nodes.
+ */
+constexpr localIndex maxNodesPerFace()
+{ return 4; }
+
+/**
+ * @brief Get the local indices of the nodes in a face of the element, without any allocation.
+ * @param[in] elementType Type of the element
+ * @param[in] iElement the local index of the target element
+ * @param[in] iFace the local index of the target face in the element  (this will be 0-numFacesInElement)
+ * @param[in] elementToNodes Element to nodes mapping.
+ * @param[out] nodeIndices Pointer to (at least) maxNodesPerFace() values, filled with the node indices of the face.
+ * @return The number of nodes of the face.
+ */
+localIndex getFaceNodes( ElementType const & elementType,
+                         localIndex const iElement,
+                         localIndex const iFace,
+                         array2d< localIndex, cells::NODE_MAP_PERMUTATION > const & elementToNodes,
+                         localIndex * const nodeIndices );
+
 /**
  * @brief Get the local indices of the nodes in a face of the element.
  * @param[in] elementType Type of the element
@@ -27,13 +27,20 @@
 
 #include "common/MpiWrapper.hpp"
 #include "common/TypeDispatch.hpp"
+#include "dataRepository/KeyHash.hpp"
 
 #include "common/DataTypes.hpp"
 #include "common/DataLayouts.hpp"
 
+#include <vtkAppendFilter.h>
 #include <vtkBoundingBox.h>
 #include <vtkCellData.h>
+#include <vtkCharArray.h>
+#include <vtkCommunicator.h>
+#include <vtkErrorCode.h>
+#include <vtkExtractCells.h>
 #include <vtkGenerateGlobalIds.h>
+#include <vtkIdList.h>
 #include <vtkPointData.h>
 #include <vtkRedistributeDataSetFilter.h>
 #include <vtkSmartPointer.h>
@@ -41,6 +48,7 @@
 #include <vtkUnstructuredGridReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
 
 #ifdef GEOSX_USE_MPI
 
@@ -51,9 +59,20 @@
   #include <vtkDummyController.h>
 #endif
 
+#ifdef GEOSX_USE_PARMETIS
+#include <parmetis.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <numeric>
 #include <unordered_set>
 
+#include <sys/stat.h>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -61,16 +80,47 @@ using namespace dataRepository;
 
 VTKMeshGenerator::VTKMeshGenerator( string const & name,
                                     Group * const parent )
-  : MeshGeneratorBase( name, parent )
+  : MeshGeneratorBase( name, parent ),
+  m_partitionMethod( PartitionMethod::kdtree )
 {
   registerWrapper( viewKeyStruct::filePathString(), &m_filePath ).
     setInputFlag( InputFlags::REQUIRED ).
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "path to the mesh file" );
+
+  registerWrapper( viewKeyStruct::partitionMethodString(), &m_partitionMethod ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_partitionMethod ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Method used to distribute the cells among the MPI ranks. Valid options:\n* " +
+                    EnumStrings< PartitionMethod >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::partitionWeightsString(), &m_partitionWeightsFieldName ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( "" ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Name of the cell field used as the cost of each cell by the graph partitioner "
+                    "(relative costs, negative values are treated as zero). "
+                    "If not provided, all the volume cells have the same cost" );
+
+  registerWrapper( viewKeyStruct::partitionCacheDirectoryString(), &m_partitionCacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory where each rank caches its part of the imported and partitioned VTK mesh. "
+                    "The cache is reused by the runs with the same mesh file, partitioning inputs and number of ranks, "
+                    "which skip the import and the partitioning of the mesh. "
+                    "The GEOSX mesh (MeshLevel maps, ghosts, sets and global indices) is not cached and is built at every run. "
+                    "If not provided, the mesh is imported and partitioned at every run" );
 }
 
 void VTKMeshGenerator::postProcessInput()
-{ }
+{
+#ifndef GEOSX_USE_PARMETIS
+  GEOSX_THROW_IF( m_partitionMethod == PartitionMethod::parmetis,
+                  getName() << ": the parmetis partition method requires GEOSX to be built with ParMETIS (ENABLE_PARMETIS)",
+                  InputError );
+#endif
+}
 
 Group * VTKMeshGenerator::createChild( string const &
                                        GEOSX_UNUSED_PARAM( childKey ),
@@ -154,15 +204,9 @@ vtkSmartPointer< vtkUnstructuredGrid > loadVTKMesh( Path const & filePath )
     vtkSmartPointer< vtkXMLPUnstructuredGridReader > vtkUgReader = vtkSmartPointer< vtkXMLPUnstructuredGridReader >::New();
     vtkUgReader->SetFileName( filePath.c_str() );
     vtkUgReader->UpdateInformation();
-    int const numberOfPieces = vtkUgReader->GetNumberOfPieces();
-    if( MpiWrapper::commSize() == 1 )
-    {
-      vtkUgReader->Update();
-    }
-    else if( MpiWrapper::commRank() < numberOfPieces )
-    {
-      vtkUgReader->UpdatePiece( MpiWrapper::commRank(), 2, 0 ); // TODO What's that numPieces = 2?
-    }
+    // Each rank reads a contiguous range of the pieces of the file (possibly none if there are more ranks
+    // than pieces), so that no rank holds more than its share of the mesh before the redistribution.
+    vtkUgReader->UpdatePiece( MpiWrapper::commRank(), MpiWrapper::commSize(), 0 );
     loadedMesh = vtkUgReader->GetOutput();
   }
   else
@@ -198,6 +242,21 @@ vtkSmartPointer< vtkUnstructuredGrid > loadVTKMesh( Path const & filePath )
   return loadedMesh;
 }
 
+/**
+ * @brief Generate the global ids of the points and cells of a distributed mesh
+ * @param[in] mesh the local part of the distributed mesh
+ * @return the local part of the mesh with the "GlobalPointIds" and "GlobalCellIds" fields
+ * @details The points duplicated on several ranks get the same global id.
+ * @note This function makes MPI calls.
+ */
+vtkSmartPointer< vtkUnstructuredGrid > generateGlobalIds( vtkUnstructuredGrid & mesh )
+{
+  vtkNew< vtkGenerateGlobalIds > generator;
+  generator->SetInputDataObject( &mesh );
+  generator->Update();
+  return vtkSmartPointer< vtkUnstructuredGrid >( vtkUnstructuredGrid::SafeDownCast( generator->GetOutputDataObject( 0 ) ) );
+}
+
 /**
  * @brief Redistribute the mesh among the available MPI ranks
  * @details this method will also generate global ids for points and cells in the VTK Mesh
@@ -217,11 +276,7 @@ vtkSmartPointer< vtkUnstructuredGrid > redistributeMesh( vtkUnstructuredGrid & l
   cuts = rdsf->GetCuts();
 
   // Generate global IDs for vertices and cells
-  vtkNew< vtkGenerateGlobalIds > generator;
-  generator->SetInputDataObject( vtkUnstructuredGrid::SafeDownCast( rdsf->GetOutputDataObject( 0 ) ) );
-  generator->Update();
-  vtkSmartPointer< vtkUnstructuredGrid > mesh = vtkUnstructuredGrid::SafeDownCast( generator->GetOutputDataObject( 0 ) );
-  return mesh;
+  return generateGlobalIds( *vtkUnstructuredGrid::SafeDownCast( rdsf->GetOutputDataObject( 0 ) ) );
 }
 
 /**
@@ -233,7 +288,8 @@ vtkSmartPointer< vtkUnstructuredGrid > redistributeMesh( vtkUnstructuredGrid & l
 double writeMeshNodes( CellBlockManager & cellBlockManager,
                        vtkSmartPointer< vtkUnstructuredGrid > mesh )
 {
-  cellBlockManager.setNumNodes( mesh->GetNumberOfPoints() );
+  // errors out if the number of local nodes does not fit in localIndex (see GEOSX_ENABLE_32BIT_LOCALINDEX)
+  cellBlockManager.setNumNodes( LvArray::integerConversion< localIndex >( mesh->GetNumberOfPoints() ) );
   arrayView1d< globalIndex > const & nodeLocalToGlobal = cellBlockManager.getNodeLocalToGlobal();
 
   // Writing the points
@@ -289,6 +345,414 @@ std::set< int > computeMPINeighborRanks( const std::vector< vtkBoundingBox > & c
   return rankNeighbor;
 }
 
+/**
+ * @brief Gather the bounding boxes of the local meshes of all ranks
+ * @param[in] mesh the local part of the distributed mesh
+ * @return the bounding boxes of all ranks, to be used by @p computeMPINeighborRanks
+ * @note This function makes MPI calls.
+ */
+std::vector< vtkBoundingBox > gatherBoundingBoxes( vtkUnstructuredGrid & mesh )
+{
+  array1d< real64 > localBounds( 6 );
+  mesh.GetBounds( localBounds.data() );
+
+  array1d< real64 > allBounds;
+  MpiWrapper::allGather( localBounds.toViewConst(), allBounds );
+
+  std::vector< vtkBoundingBox > boxes;
+  boxes.reserve( MpiWrapper::commSize() );
+  for( int rank = 0; rank < MpiWrapper::commSize(); ++rank )
+  {
+    boxes.emplace_back( &allBounds[6 * rank] );
+  }
+  return boxes;
+}
+
+/**
+ * @brief Get the common prefix of the files caching the distributed mesh
+ * @param[in] cacheDirectory the directory of the cache
+ * @param[in] filePath the path of the mesh file
+ * @param[in] partitionInputs the description of the partitioning inputs
+ * @return the prefix of the cache files, the file of each rank being prefix_rank.vtu
+ * @details The prefix contains the 64-bit FNV-1a hash of the path, size and modification time of the mesh file,
+ * of the partitioning inputs and of the number of ranks, so that a cache is never used for another mesh
+ * or partitioning. The pieces of a .pvtu file are not checked, only the .pvtu file itself.
+ * @note This function makes MPI calls.
+ */
+string getPartitionCachePrefix( string const & cacheDirectory,
+                           Path const & filePath,
+                           string const & partitionInputs )
+{
+  // the mesh file is only accessed by the root rank, so that all the ranks compute the same prefix
+  long long fileStatus[3] = { 0, 0, 0 }; // found, size, modification time
+  if( MpiWrapper::commRank() == 0 )
+  {
+    struct stat status{};
+    if( stat( filePath.c_str(), &status ) == 0 )
+    {
+      fileStatus[0] = 1;
+      fileStatus[1] = status.st_size;
+      fileStatus[2] = status.st_mtime;
+    }
+  }
+  MpiWrapper::bcast( fileStatus, 3, 0, MPI_COMM_GEOSX );
+  GEOSX_THROW_IF( fileStatus[0] == 0,
+                  "Could not access the mesh file " << filePath,
+                  InputError );
+
+  std::ostringstream inputs;
+  inputs << filePath << ' ' << fileStatus[1] << ' ' << fileStatus[2] << ' '
+         << partitionInputs << ' ' << MpiWrapper::commSize();
+
+  std::ostringstream prefix;
+  prefix << splitPath( filePath ).second << '_'
+         << std::hex << std::setw( 16 ) << std::setfill( '0' ) << dataRepository::keyHash( inputs.str() );
+  return joinPath( cacheDirectory, prefix.str() );
+}
+
+/**
+ * @brief Get the name of the file caching the local part of the distributed mesh
+ * @param[in] cachePrefix the prefix of the cache files
+ * @return the name of the cache file of this rank
+ */
+string getPartitionCacheFileName( string const & cachePrefix )
+{
+  return cachePrefix + "_" + std::to_string( MpiWrapper::commRank() ) + ".vtu";
+}
+
+/**
+ * @brief Get the name of the file telling that the cache files of all the ranks are complete
+ * @param[in] cachePrefix the prefix of the cache files
+ * @return the name of the marker file, written by the root rank once all the ranks have written their file
+ */
+string getPartitionCacheMarkerFileName( string const & cachePrefix )
+{
+  return cachePrefix + ".complete";
+}
+
+/**
+ * @brief Load the local part of the distributed mesh from the cache
+ * @param[in] cachePrefix the prefix of the cache files
+ * @return the local part of the distributed mesh, or nullptr if the cache is incomplete or could not be read on any rank
+ * @note This function makes MPI calls.
+ */
+vtkSmartPointer< vtkUnstructuredGrid > readPartitionCache( string const & cachePrefix )
+{
+  // the root rank checks that the cache was completely written, then either all the ranks use it or none of them
+  int complete = 0;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    complete = std::ifstream( getPartitionCacheMarkerFileName( cachePrefix ) ).good() ? 1 : 0;
+  }
+  MpiWrapper::broadcast( complete );
+  if( complete == 0 )
+  {
+    return nullptr;
+  }
+
+  vtkNew< vtkXMLUnstructuredGridReader > reader;
+  reader->SetFileName( getPartitionCacheFileName( cachePrefix ).c_str() );
+  reader->Update();
+  int const success = ( reader->GetErrorCode() == vtkErrorCode::NoError && reader->GetOutput() != nullptr ) ? 1 : 0;
+  if( MpiWrapper::min( success ) == 0 )
+  {
+    GEOSX_LOG_RANK_0( "VTKMeshGenerator: the partition cache " << cachePrefix << " could not be read, it will be rebuilt" );
+    return nullptr;
+  }
+  return vtkSmartPointer< vtkUnstructuredGrid >( reader->GetOutput() );
+}
+
+/**
+ * @brief Write the local part of the distributed mesh into the cache
+ * @param[in] mesh the local part of the distributed mesh, with the global ids of its points and cells
+ * @param[in] cacheDirectory the directory of the cache
+ * @param[in] cachePrefix the prefix of the cache files
+ * @details Each rank writes its file under a temporary name and renames it once it is complete. The marker
+ * file, without which the cache is not used, is only written when all the ranks have succeeded, so that an
+ * interrupted or failed write never leaves a cache that would be trusted by the next run.
+ * @note This function makes MPI calls.
+ */
+void writePartitionCache( vtkUnstructuredGrid & mesh,
+                     string const & cacheDirectory,
+                     string const & cachePrefix )
+{
+  string const markerFileName = getPartitionCacheMarkerFileName( cachePrefix );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    makeDirsForPath( cacheDirectory );
+    // a previous cache with the same inputs could not be read, it is invalidated before being overwritten
+    std::remove( markerFileName.c_str() );
+  }
+  MpiWrapper::barrier();
+
+  string const cacheFileName = getPartitionCacheFileName( cachePrefix );
+  string const tmpFileName = cacheFileName + ".tmp";
+
+  // raw binary data, so that reading the cache is not slowed down by the decoding
+  vtkNew< vtkXMLUnstructuredGridWriter > writer;
+  writer->SetFileName( tmpFileName.c_str() );
+  writer->SetInputData( &mesh );
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  int const success = ( writer->Write() == 1 &&
+                        writer->GetErrorCode() == vtkErrorCode::NoError &&
+                        std::rename( tmpFileName.c_str(), cacheFileName.c_str() ) == 0 ) ? 1 : 0;
+  if( success == 0 )
+  {
+    std::remove( tmpFileName.c_str() );
+  }
+
+  if( MpiWrapper::min( success ) == 0 )
+  {
+    GEOSX_LOG_RANK_0( "VTKMeshGenerator: the partition cache could not be written in " << cacheDirectory );
+    return;
+  }
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    string const tmpMarkerFileName = markerFileName + ".tmp";
+    std::ofstream marker( tmpMarkerFileName );
+    marker << MpiWrapper::commSize() << std::endl;
+    marker.close();
+    if( !marker || std::rename( tmpMarkerFileName.c_str(), markerFileName.c_str() ) != 0 )
+    {
+      std::remove( tmpMarkerFileName.c_str() );
+      GEOSX_LOG_RANK_0( "VTKMeshGenerator: the partition cache could not be written in " << cacheDirectory );
+    }
+  }
+}
+
+/**
+ * @brief Compute the partitioning cost of each cell of the mesh
+ * @param[in] mesh the vtkUnstructuredGrid that is loaded
+ * @param[in] weightsFieldName the name of the cell field holding the costs (unit cost if empty)
+ * @return the cost of each cell, zero for the surface cells
+ */
+std::vector< real64 > computeCellWeights( vtkUnstructuredGrid & mesh,
+                                          string const & weightsFieldName )
+{
+  vtkDataArray * const weightsArray = weightsFieldName.empty() ? nullptr : mesh.GetCellData()->GetArray( weightsFieldName.c_str() );
+  GEOSX_ERROR_IF( !weightsFieldName.empty() && mesh.GetNumberOfCells() > 0 && weightsArray == nullptr,
+                  "Partitioning weights field '" << weightsFieldName << "' not found in the mesh" );
+
+  std::vector< real64 > weights( mesh.GetNumberOfCells() );
+  for( vtkIdType c = 0; c < mesh.GetNumberOfCells(); ++c )
+  {
+    switch( mesh.GetCellType( c ) )
+    {
+      case VTK_HEXAHEDRON:
+      case VTK_TETRA:
+      case VTK_WEDGE:
+      case VTK_PYRAMID:
+        weights[c] = ( weightsArray != nullptr ) ? std::max( 0.0, weightsArray->GetTuple1( c ) ) : 1.0;
+        break;
+      default:
+        // surface cells only define sets, they do not carry any computational cost
+        weights[c] = 0.0;
+    }
+  }
+  return weights;
+}
+
+/**
+ * @brief Log the imbalance of the cell costs across the ranks
+ * @param[in] mesh the local part of the distributed mesh
+ * @param[in] weightsFieldName the name of the cell field holding the costs (unit cost if empty)
+ * @note This function makes MPI calls.
+ */
+void reportPartitionImbalance( vtkUnstructuredGrid & mesh,
+                               string const & weightsFieldName )
+{
+  std::vector< real64 > const weights = computeCellWeights( mesh, weightsFieldName );
+  real64 const localWeight = std::accumulate( weights.begin(), weights.end(), 0.0 );
+  real64 const maxWeight = MpiWrapper::max( localWeight );
+  real64 const averageWeight = MpiWrapper::sum( localWeight ) / MpiWrapper::commSize();
+
+  GEOSX_LOG_RANK_0( "VTKMeshGenerator: partition imbalance (max / average cell cost per rank) = "
+                    << ( averageWeight > 0.0 ? maxWeight / averageWeight : 1.0 ) );
+}
+
+/**
+ * @brief Migrate the cells of a distributed mesh to their target rank
+ * @param[in] mesh the local part of the distributed mesh
+ * @param[in] cellRanks the target rank of each local cell
+ * @return the local part of the redistributed mesh
+ * @details The global ids of the points and cells are carried along with the other point and cell fields.
+ * @note This function makes MPI calls.
+ */
+vtkSmartPointer< vtkUnstructuredGrid > migrateCells( vtkUnstructuredGrid & mesh,
+                                                     std::vector< int > const & cellRanks )
+{
+  int const numRanks = MpiWrapper::commSize();
+  int const thisRank = MpiWrapper::commRank();
+
+  std::vector< vtkSmartPointer< vtkIdList > > cellsToRank( numRanks );
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    cellsToRank[rank] = vtkSmartPointer< vtkIdList >::New();
+  }
+  for( vtkIdType c = 0; c < mesh.GetNumberOfCells(); ++c )
+  {
+    cellsToRank[cellRanks[c]]->InsertNextId( c );
+  }
+
+  auto extractCells = [&]( vtkIdList * const cellIds )
+  {
+    vtkNew< vtkExtractCells > extractor;
+    extractor->SetInputDataObject( &mesh );
+    extractor->SetCellList( cellIds );
+    extractor->Update();
+    return vtkSmartPointer< vtkUnstructuredGrid >( extractor->GetOutput() );
+  };
+
+  // Serialize the cells sent to each other rank
+  std::vector< vtkSmartPointer< vtkCharArray > > sendBuffers( numRanks );
+  array1d< int > sendSizes( numRanks );
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    if( rank != thisRank && cellsToRank[rank]->GetNumberOfIds() > 0 )
+    {
+      sendBuffers[rank] = vtkSmartPointer< vtkCharArray >::New();
+      vtkCommunicator::MarshalDataObject( extractCells( cellsToRank[rank] ), sendBuffers[rank] );
+      sendSizes[rank] = LvArray::integerConversion< int >( sendBuffers[rank]->GetNumberOfValues() );
+    }
+  }
+
+  // allSendSizes[r * numRanks + s] is the size of the buffer sent by rank r to rank s
+  array1d< int > allSendSizes;
+  MpiWrapper::allGather( sendSizes.toViewConst(), allSendSizes );
+
+  int const tag = 54673;
+  std::vector< vtkSmartPointer< vtkCharArray > > recvBuffers( numRanks );
+  std::vector< MPI_Request > requests;
+  requests.reserve( 2 * numRanks );
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    int const recvSize = allSendSizes[rank * numRanks + thisRank];
+    if( rank != thisRank && recvSize > 0 )
+    {
+      recvBuffers[rank] = vtkSmartPointer< vtkCharArray >::New();
+      recvBuffers[rank]->SetNumberOfValues( recvSize );
+      requests.emplace_back();
+      MpiWrapper::iRecv( recvBuffers[rank]->GetPointer( 0 ), recvSize, rank, tag, MPI_COMM_GEOSX, &requests.back() );
+    }
+  }
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    if( sendSizes[rank] > 0 )
+    {
+      requests.emplace_back();
+      MpiWrapper::iSend( sendBuffers[rank]->GetPointer( 0 ), sendSizes[rank], rank, tag, MPI_COMM_GEOSX, &requests.back() );
+    }
+  }
+  std::vector< MPI_Status > statuses( requests.size() );
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), statuses.data() );
+
+  // Merge the kept cells with the received ones, the points on the former rank boundaries being merged
+  vtkNew< vtkAppendFilter > appender;
+  appender->MergePointsOn();
+  appender->AddInputData( extractCells( cellsToRank[thisRank] ) );
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    if( recvBuffers[rank] != nullptr )
+    {
+      vtkNew< vtkUnstructuredGrid > receivedCells;
+      vtkCommunicator::UnMarshalDataObject( recvBuffers[rank], receivedCells );
+      appender->AddInputData( receivedCells );
+    }
+  }
+  appender->Update();
+
+  return vtkSmartPointer< vtkUnstructuredGrid >( appender->GetOutput() );
+}
+
+#ifdef GEOSX_USE_PARMETIS
+
+/**
+ * @brief Partition the cells of a distributed mesh with ParMETIS
+ * @param[in] mesh the local part of the distributed mesh, with global point ids
+ * @param[in] weightsFieldName the name of the cell field holding the costs (unit cost if empty)
+ * @return the target rank of each local cell
+ * @details The partitioned graph is the dual graph of the mesh, in which two cells are connected if they
+ * share a face (at least three vertices). Its edge cut is an estimate of the size of the halos.
+ * @note This function makes MPI calls.
+ */
+std::vector< int > partitionDualGraph( vtkUnstructuredGrid & mesh,
+                                       string const & weightsFieldName )
+{
+  MPI_Comm comm = MPI_COMM_GEOSX;
+  idx_t numParts = MpiWrapper::commSize();
+
+  // Distribution of the cells among the ranks
+  idx_t const numLocalCells = LvArray::integerConversion< idx_t >( mesh.GetNumberOfCells() );
+  array1d< idx_t > numCellsPerRank;
+  MpiWrapper::allGather( numLocalCells, numCellsPerRank );
+  GEOSX_ERROR_IF( std::find( numCellsPerRank.begin(), numCellsPerRank.end(), 0 ) != numCellsPerRank.end(),
+                  "ParMETIS requires at least one cell on each rank before partitioning" );
+  std::vector< idx_t > cellDist( numParts + 1, 0 );
+  std::partial_sum( numCellsPerRank.begin(), numCellsPerRank.end(), cellDist.begin() + 1 );
+
+  // Cell to global vertex map, in CSR format
+  vtkIdTypeArray const & globalPointIds = getDataArray< vtkIdTypeArray >( mesh.GetPointData(), "GlobalPointIds" );
+  std::vector< idx_t > cellOffsets( numLocalCells + 1, 0 );
+  std::vector< idx_t > cellVertices;
+  cellVertices.reserve( 8 * numLocalCells );
+  vtkNew< vtkIdList > pointIds;
+  for( vtkIdType c = 0; c < numLocalCells; ++c )
+  {
+    mesh.GetCellPoints( c, pointIds );
+    for( vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i )
+    {
+      cellVertices.emplace_back( globalPointIds.GetValue( pointIds->GetId( i ) ) );
+    }
+    cellOffsets[c + 1] = LvArray::integerConversion< idx_t >( cellVertices.size() );
+  }
+
+  idx_t numFlag = 0;
+  idx_t numCommonNodes = 3;
+  idx_t * xadj = nullptr;
+  idx_t * adjncy = nullptr;
+  GEOSX_ERROR_IF_NE_MSG( ParMETIS_V3_Mesh2Dual( cellDist.data(), cellOffsets.data(), cellVertices.data(),
+                                                &numFlag, &numCommonNodes, &xadj, &adjncy, &comm ),
+                         METIS_OK,
+                         "ParMETIS_V3_Mesh2Dual failed" );
+
+  // ParMETIS only takes integer weights: the costs are scaled such that the most expensive cell weighs
+  // WEIGHT_RESOLUTION, which preserves fractional costs, and every cell weighs at least 1
+  idx_t constexpr WEIGHT_RESOLUTION = 1000;
+  std::vector< real64 > const weights = computeCellWeights( mesh, weightsFieldName );
+  real64 const maxWeight = MpiWrapper::max( weights.empty() ? 0.0 : *std::max_element( weights.begin(), weights.end() ) );
+  real64 const weightScale = maxWeight > 0.0 ? WEIGHT_RESOLUTION / maxWeight : 0.0;
+  std::vector< idx_t > cellWeights( numLocalCells );
+  std::transform( weights.begin(), weights.end(), cellWeights.begin(), [weightScale]( real64 const w )
+  {
+    return std::max( idx_t( 1 ), static_cast< idx_t >( std::lround( w * weightScale ) ) );
+  } );
+
+  idx_t weightFlag = 2; // vertex weights only
+  idx_t numConstraints = 1;
+  std::vector< real_t > targetPartWeights( numParts, 1.0 / numParts );
+  real_t imbalanceTolerance = 1.05;
+  idx_t options[3] = { 0, 0, 0 };
+  idx_t edgeCut = 0;
+  std::vector< idx_t > parts( numLocalCells );
+  GEOSX_ERROR_IF_NE_MSG( ParMETIS_V3_PartKway( cellDist.data(), xadj, adjncy, cellWeights.data(), nullptr,
+                                               &weightFlag, &numFlag, &numConstraints, &numParts,
+                                               targetPartWeights.data(), &imbalanceTolerance, options,
+                                               &edgeCut, parts.data(), &comm ),
+                         METIS_OK,
+                         "ParMETIS_V3_PartKway failed" );
+
+  METIS_Free( xadj );
+  METIS_Free( adjncy );
+
+  GEOSX_LOG_RANK_0( "VTKMeshGenerator: ParMETIS edge cut of the cell dual graph = " << edgeCut );
+
+  return std::vector< int >( parts.begin(), parts.end() );
+}
+
+#endif // GEOSX_USE_PARMETIS
+
 /**
  * @brief Gathers all the data from all ranks, merge them, sort them, and remove duplicates.
  * @tparam T Type of the exchanged data.
@@ -863,10 +1327,54 @@ void VTKMeshGenerator::generateMesh( DomainPartition & domain )
   vtkSmartPointer< vtkMultiProcessController > controller = getVTKController();
   vtkMultiProcessController::SetGlobalController( controller );
 
-  vtkSmartPointer< vtkUnstructuredGrid > loadedMesh = loadVTKMesh( m_filePath );
+  string const cachePrefix =
+    m_partitionCacheDirectory.empty() ? "" : getPartitionCachePrefix( m_partitionCacheDirectory,
+                                                            m_filePath,
+                                                            EnumStrings< PartitionMethod >::toString( m_partitionMethod ) + " " + m_partitionWeightsFieldName );
 
   std::vector< vtkBoundingBox > cuts;
-  m_vtkMesh = redistributeMesh( *loadedMesh, cuts );
+  if( !cachePrefix.empty() )
+  {
+    m_vtkMesh = readPartitionCache( cachePrefix );
+  }
+
+  if( m_vtkMesh )
+  {
+    GEOSX_LOG_RANK_0( "VTKMeshGenerator: loading the partitioned mesh from the cache in " << m_partitionCacheDirectory );
+    // the bounding boxes of the local meshes overlap those of all their neighbors
+    cuts = gatherBoundingBoxes( *m_vtkMesh );
+  }
+  else
+  {
+    vtkSmartPointer< vtkUnstructuredGrid > loadedMesh = loadVTKMesh( m_filePath );
+
+#ifdef GEOSX_USE_PARMETIS
+    bool const partitionWithParmetis = m_partitionMethod == PartitionMethod::parmetis && MpiWrapper::commSize() > 1;
+    // When every rank has read a slice of the mesh (.pvtu file with at least as many pieces as ranks),
+    // the slices are partitioned as they are: the kd-tree redistribution of the whole mesh is skipped.
+    bool const partitionSlices = partitionWithParmetis && MpiWrapper::min( loadedMesh->GetNumberOfCells() > 0 ? 1 : 0 ) == 1;
+#else
+    bool const partitionSlices = false;
+#endif
+
+    m_vtkMesh = partitionSlices ? generateGlobalIds( *loadedMesh ) : redistributeMesh( *loadedMesh, cuts );
+    // The pieces read from the file are not needed anymore, release them before building the GEOSX mesh.
+    loadedMesh = nullptr;
+
+#ifdef GEOSX_USE_PARMETIS
+    if( partitionWithParmetis )
+    {
+      m_vtkMesh = migrateCells( *m_vtkMesh, partitionDualGraph( *m_vtkMesh, m_partitionWeightsFieldName ) );
+      cuts = gatherBoundingBoxes( *m_vtkMesh );
+    }
+#endif
+
+    if( !cachePrefix.empty() )
+    {
+      writePartitionCache( *m_vtkMesh, m_partitionCacheDirectory, cachePrefix );
+    }
+  }
+  reportPartitionImbalance( *m_vtkMesh, m_partitionWeightsFieldName );
 
   Group & meshBodies = domain.getMeshBodies();
   MeshBody & meshBody = meshBodies.registerGroup< MeshBody >( this->getName() );
@@ -22,6 +22,7 @@
 #include "dataRepository/Group.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "codingUtilities/StringUtilities.hpp"
+#include "codingUtilities/EnumStrings.hpp"
 
 #include "MeshGeneratorBase.hpp"
 
@@ -58,6 +59,16 @@ public:
  */
   static string catalogName() { return "VTKMeshGenerator"; }
 
+  /**
+   * @enum PartitionMethod
+   * @brief Method used to distribute the cells of the mesh among the MPI ranks
+   */
+  enum class PartitionMethod : integer
+  {
+    kdtree,  ///< Geometric kd-tree cuts (vtkRedistributeDataSetFilter)
+    parmetis ///< Partition of the cell dual graph computed with ParMETIS
+  };
+
 protected:
   /**
    * @brief This function provides capability to post process input values prior to
@@ -70,6 +81,9 @@ private:
   struct viewKeyStruct
   {
     constexpr static char const * filePathString() { return "file"; }
+    constexpr static char const * partitionMethodString() { return "partitionMethod"; }
+    constexpr static char const * partitionWeightsString() { return "partitionWeights"; }
+    constexpr static char const * partitionCacheDirectoryString() { return "partitionCacheDirectory"; }
   };
 /// @endcond
 
@@ -86,8 +100,24 @@ private:
    * - If a .vtu of .vtk file is used, the root MPI process will load it.
    *   The mesh will be then redistribute among all the available MPI processes
    * - If a .pvtu file is used, it means that the mesh is pre-partionned in the file system.
-   *   The available MPI processes will load the pre-partionned mesh. The mesh will be then
-   *   redistributed among ALL the available MPI processes.\n\n
+   *   Each MPI process loads a contiguous range of the pieces (the pieces being split as evenly
+   *   as possible among the processes), so that the whole mesh is never held by a single process.
+   *   The mesh will be then redistributed among ALL the available MPI processes.
+   *   Large meshes should therefore be provided as a .pvtu file with at least as many pieces as processes.\n\n
+   *
+   * With the "parmetis" partition method, the kd-tree distribution is only used as a starting point:
+   * the dual graph of the cells (two cells being connected if they share a face) is then partitioned
+   * with ParMETIS, optionally using the cell field "partitionWeights" as the cost of each cell, and
+   * the cells are migrated to their new rank. The edge cut and the imbalance of the resulting
+   * partition are reported in the log. If every process has read at least one piece of a .pvtu file,
+   * the kd-tree distribution is skipped and the pieces are partitioned and migrated as they were read,
+   * so that the mesh is moved between the processes only once.\n\n
+   *
+   * If a partition cache directory is provided, the local part of the imported and partitioned VTK mesh is
+   * written there by each MPI process (one binary .vtu file per process). The following runs using the same
+   * mesh file, partitioning inputs and number of processes load these files directly, skipping the import and
+   * the partitioning. Only these two stages are cached, not the MeshLevel: the GEOSX mesh objects (maps, ghosts,
+   * sets, global indices) are still built from the VTK mesh at every run.\n\n
    *
    * The properties on the mesh will be also and redistributed. The only compatible types are double and float.
    * The properties can be multi-dimensional.\n
@@ -132,6 +162,15 @@ private:
   /// Path to the mesh file
   Path m_filePath;
 
+  /// Method used to distribute the cells among the MPI ranks
+  PartitionMethod m_partitionMethod;
+
+  /// Name of the cell field used as partitioning weights
+  string m_partitionWeightsFieldName;
+
+  /// Directory of the per-rank cache of the imported and partitioned VTK mesh (no cache if empty)
+  Path m_partitionCacheDirectory;
+
   std::map< int, std::vector< vtkIdType > > m_regionsHex;
   std::map< int, std::vector< vtkIdType > > m_regionsTetra;
   std::map< int, std::vector< vtkIdType > > m_regionsWedges;
@@ -139,5 +178,11 @@ private:
 
   std::vector< vtkDataArray * > m_importableArrays;
 };
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( VTKMeshGenerator::PartitionMethod,
+              "kdtree",
+              "parmetis" );
+
 }
 #endif /* GEOSX_MESHUTILITIES_VTKMESHGENERATOR_HPP */
@@ -774,6 +774,74 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   faceManager.compressRelationMaps();
 }
 
+namespace
+{
+
+/**
+ * @brief Allocate the lazily allocated fields to synchronize on all the ranks as soon as one of them has allocated them
+ * @param[in] fieldNames the names of the fields to synchronize for each type of mesh object
+ * @param[in] mesh the mesh level holding the fields
+ * @details A lazily allocated field is allocated by its first write access, which may only happen on some ranks.
+ * Otherwise, the values of an allocated field would be unpacked into the empty storage of a rank that never wrote
+ * to it, or the ghost values of an allocated field would be left unchanged when their owner never wrote to it.
+ * @note This function makes MPI calls.
+ */
+void allocateLazyFields( std::map< string, string_array > const & fieldNames,
+                         MeshLevel & mesh )
+{
+  // the lazy allocation flag is set at registration, so that this list is the same on all the ranks
+  std::vector< WrapperBase * > lazyWrappers;
+  auto gatherLazyWrappers = [&]( ObjectManagerBase & manager, string const & objectType )
+  {
+    auto const it = fieldNames.find( objectType );
+    if( it == fieldNames.end() )
+    {
+      return;
+    }
+    for( string const & fieldName : it->second )
+    {
+      if( manager.hasWrapper( fieldName ) && manager.getWrapperBase( fieldName ).isLazyAllocation() )
+      {
+        lazyWrappers.push_back( &manager.getWrapperBase( fieldName ) );
+      }
+    }
+  };
+  gatherLazyWrappers( mesh.getNodeManager(), "node" );
+  gatherLazyWrappers( mesh.getEdgeManager(), "edge" );
+  gatherLazyWrappers( mesh.getFaceManager(), "face" );
+  mesh.getElemManager().forElementSubRegions( [&]( ElementSubRegionBase & subRegion )
+  {
+    gatherLazyWrappers( subRegion, "elems" );
+  } );
+
+  if( lazyWrappers.empty() )
+  {
+    return;
+  }
+
+  int const numLazyWrappers = LvArray::integerConversion< int >( lazyWrappers.size() );
+  array1d< integer > locallyAllocated( numLazyWrappers );
+  array1d< integer > globallyAllocated( numLazyWrappers );
+  for( int i = 0; i < numLazyWrappers; ++i )
+  {
+    locallyAllocated[i] = lazyWrappers[i]->isAllocated() ? 1 : 0;
+  }
+  MpiWrapper::allReduce( locallyAllocated.data(),
+                         globallyAllocated.data(),
+                         numLazyWrappers,
+                         MPI_MAX,
+                         MPI_COMM_GEOSX );
+  for( int i = 0; i < numLazyWrappers; ++i )
+  {
+    if( globallyAllocated[i] == 1 )
+    {
+      lazyWrappers[i]->allocate();
+    }
+  }
+}
+
+} // namespace
+
 void CommunicationTools::synchronizePackSendRecvSizes( const std::map< string, string_array > & fieldNames,
                                                        MeshLevel & mesh,
                                                        std::vector< NeighborCommunicator > & neighbors,
@@ -781,6 +849,7 @@ void CommunicationTools::synchronizePackSendRecvSizes( const std::map< string, s
                                                        bool onDevice )
 {
   GEOSX_MARK_FUNCTION;
+  allocateLazyFields( fieldNames, mesh );
   icomm.fieldNames().insert( fieldNames.begin(), fieldNames.end() );
   icomm.resize( neighbors.size() );
 
@@ -19,6 +19,8 @@
 #include "BoundedPlane.hpp"
 #include "LvArray/src/tensorOps.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -119,6 +121,15 @@ void BoundedPlane::findRectangleLimits()
   }
 }
 
+void BoundedPlane::getBoundingBox( real64 ( & boxMin )[3], real64 ( & boxMax )[3] ) const
+{
+  for( integer d = 0; d < 3; ++d )
+  {
+    boxMin[d] = std::min( { m_points[0][d], m_points[1][d], m_points[2][d], m_points[3][d] } ) - m_tolerance;
+    boxMax[d] = std::max( { m_points[0][d], m_points[1][d], m_points[2][d], m_points[3][d] } ) + m_tolerance;
+  }
+}
+
 bool BoundedPlane::isCoordInObject( real64 const ( &coord ) [3] ) const
 {
   bool isInside = true;
@@ -121,6 +121,8 @@ public:
    */
   R1Tensor const & getLengthVector() const {return m_lengthVector;}
 
+  void getBoundingBox( real64 ( &boxMin )[3], real64 ( &boxMax )[3] ) const override final;
+
 
 protected:
 
@@ -100,6 +100,22 @@ bool Box::isCoordInObject( real64 const ( &coord ) [3] ) const
   return true;
 }
 
+void Box::getBoundingBox( real64 ( & boxMin )[3], real64 ( & boxMax )[3] ) const
+{
+  LvArray::tensorOps::copy< 3 >( boxMin, m_min );
+  LvArray::tensorOps::copy< 3 >( boxMax, m_max );
+  if( std::fabs( m_strikeAngle ) >= 1e-20 )
+  {
+    // the box is rotated around the vertical axis going through its center
+    real64 const halfDiagonal = 0.5 * std::hypot( m_max[0] - m_min[0], m_max[1] - m_min[1] );
+    for( int i = 0; i < 2; ++i )
+    {
+      boxMin[i] = m_boxCenter[i] - halfDiagonal;
+      boxMax[i] = m_boxCenter[i] + halfDiagonal;
+    }
+  }
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, string const &, Group * const )
 
 } /* namespace geosx */
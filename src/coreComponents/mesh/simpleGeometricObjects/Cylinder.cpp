@@ -83,6 +83,17 @@ bool Cylinder::isCoordInObject( real64 const ( &coord ) [3] ) const
   return rval;
 }
 
+void Cylinder::getBoundingBox( real64 ( & boxMin )[3], real64 ( & boxMax )[3] ) const
+{
+  // isCoordInObject only bounds the distance to point1 along the axis, on both sides of point1
+  for( int i = 0; i < 3; ++i )
+  {
+    real64 const mirroredPoint2 = 2.0 * m_point1[i] - m_point2[i];
+    boxMin[i] = std::min( mirroredPoint2, m_point2[i] ) - m_radius;
+    boxMax[i] = std::max( mirroredPoint2, m_point2[i] ) + m_radius;
+  }
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, string const &, Group * const )
 
 } /* namespace geosx */
@@ -68,6 +68,8 @@ public:
 
   bool isCoordInObject( real64 const ( &coord ) [3] ) const override final;
 
+  void getBoundingBox( real64 ( &boxMin )[3], real64 ( &boxMax )[3] ) const override final;
+
 
 private:
 
@@ -33,6 +33,15 @@ SimpleGeometricObjectBase::~SimpleGeometricObjectBase()
 {}
 
 
+void SimpleGeometricObjectBase::getBoundingBox( real64 ( & boxMin )[3], real64 ( & boxMax )[3] ) const
+{
+  for( integer d = 0; d < 3; ++d )
+  {
+    boxMin[d] = std::numeric_limits< real64 >::lowest();
+    boxMax[d] = std::numeric_limits< real64 >::max();
+  }
+}
+
 SimpleGeometricObjectBase::CatalogInterface::CatalogType & SimpleGeometricObjectBase::getCatalog()
 {
   static SimpleGeometricObjectBase::CatalogInterface::CatalogType catalog;
@@ -93,6 +93,16 @@ public:
    */
   virtual bool isCoordInObject( real64 const ( &coord ) [3] ) const = 0;
 
+  /**
+   * @brief Get a box containing all the coordinates considered to be in the object.
+   * @param[out] boxMin the lower corner of the box
+   * @param[out] boxMax the upper corner of the box
+   *
+   * The box is used to skip the coordinates that cannot be in the object before calling
+   * isCoordInObject. The default implementation returns an unbounded box.
+   */
+  virtual void getBoundingBox( real64 ( &boxMin )[3], real64 ( &boxMax )[3] ) const;
+
 };
 
 
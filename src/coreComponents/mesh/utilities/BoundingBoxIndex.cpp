@@ -0,0 +1,142 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BoundingBoxIndex.cpp
+ */
+
+#include "BoundingBoxIndex.hpp"
+
+#include <limits>
+
+namespace geosx
+{
+
+BoundingBoxIndex::BoundingBoxIndex():
+  m_boxMin( 0, 3 ),
+  m_boxMax( 0, 3 ),
+  m_binOffsets( 2 )
+{}
+
+BoundingBoxIndex::BoundingBoxIndex( array2d< real64 > boxMin,
+                                    array2d< real64 > boxMax ):
+  m_boxMin( std::move( boxMin ) ),
+  m_boxMax( std::move( boxMax ) )
+{
+  GEOSX_ERROR_IF_NE( m_boxMin.size( 0 ), m_boxMax.size( 0 ) );
+  localIndex const numBoxes = size();
+
+  // Step 1: compute the bounding box of all the boxes
+
+  real64 meanExtent[3]{};
+  for( integer d = 0; d < 3; ++d )
+  {
+    m_gridMin[d] = std::numeric_limits< real64 >::max();
+    m_gridMax[d] = std::numeric_limits< real64 >::lowest();
+  }
+  for( localIndex k = 0; k < numBoxes; ++k )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      meanExtent[d] += m_boxMax[k][d] - m_boxMin[k][d];
+      m_gridMin[d] = std::min( m_gridMin[d], m_boxMin[k][d] );
+      m_gridMax[d] = std::max( m_gridMax[d], m_boxMax[k][d] );
+    }
+  }
+
+  m_binOffsets.resize( 2 );
+  if( numBoxes == 0 )
+  {
+    return;
+  }
+
+  // Step 2: size the bins like the average box, so that a box overlaps a few bins only, while keeping
+  //         the number of bins of the order of the number of boxes. The directions in which the boxes
+  //         are flat (points) get the size of a cubic bin holding a single box on average.
+
+  real64 volume = 1.0;
+  integer numDims = 0;
+  for( integer d = 0; d < 3; ++d )
+  {
+    if( m_gridMax[d] > m_gridMin[d] )
+    {
+      volume *= m_gridMax[d] - m_gridMin[d];
+      ++numDims;
+    }
+  }
+  real64 const pointBinSize = ( numDims > 0 ) ? std::pow( volume / numBoxes, 1.0 / numDims ) : 0.0;
+
+  real64 numBinsTotal = 1.0;
+  for( integer d = 0; d < 3; ++d )
+  {
+    real64 const extent = m_gridMax[d] - m_gridMin[d];
+    meanExtent[d] /= numBoxes;
+    real64 const binSize = ( meanExtent[d] > 0.0 ) ? meanExtent[d] : pointBinSize;
+    m_numBins[d] = ( extent > 0.0 && binSize > 0.0 ) ? static_cast< localIndex >( std::max( 1.0, std::min( extent / binSize, 1e6 ) ) ) : 1;
+    numBinsTotal *= m_numBins[d];
+  }
+  while( numBinsTotal > 2.0 * numBoxes + 1.0 )
+  {
+    integer const dim = static_cast< integer >( std::distance( m_numBins, std::max_element( m_numBins, m_numBins + 3 ) ) );
+    numBinsTotal = numBinsTotal / m_numBins[dim] * ( ( m_numBins[dim] + 1 ) / 2 );
+    m_numBins[dim] = ( m_numBins[dim] + 1 ) / 2;
+  }
+  localIndex const numBins = m_numBins[0] * m_numBins[1] * m_numBins[2];
+  for( integer d = 0; d < 3; ++d )
+  {
+    real64 const extent = m_gridMax[d] - m_gridMin[d];
+    m_invBinSize[d] = ( extent > 0.0 ) ? m_numBins[d] / extent : 0.0;
+  }
+
+  // Step 3: register the boxes in the bins they overlap (CSR format)
+
+  auto forOverlappedBins = [&]( localIndex const k, auto && func )
+  {
+    for( localIndex i = getBin( 0, m_boxMin[k][0] ); i <= getBin( 0, m_boxMax[k][0] ); ++i )
+    {
+      for( localIndex j = getBin( 1, m_boxMin[k][1] ); j <= getBin( 1, m_boxMax[k][1] ); ++j )
+      {
+        for( localIndex l = getBin( 2, m_boxMin[k][2] ); l <= getBin( 2, m_boxMax[k][2] ); ++l )
+        {
+          func( ( i * m_numBins[1] + j ) * m_numBins[2] + l );
+        }
+      }
+    }
+  };
+
+  m_binOffsets.resize( numBins + 1 );
+  m_binOffsets.zero();
+  for( localIndex k = 0; k < numBoxes; ++k )
+  {
+    forOverlappedBins( k, [&]( localIndex const bin ) { ++m_binOffsets[bin + 1]; } );
+  }
+  for( localIndex bin = 0; bin < numBins; ++bin )
+  {
+    m_binOffsets[bin + 1] += m_binOffsets[bin];
+  }
+
+  m_binBoxes.resize( m_binOffsets[numBins] );
+  array1d< localIndex > binCursor( numBins );
+  for( localIndex bin = 0; bin < numBins; ++bin )
+  {
+    binCursor[bin] = m_binOffsets[bin];
+  }
+  for( localIndex k = 0; k < numBoxes; ++k )
+  {
+    forOverlappedBins( k, [&]( localIndex const bin ) { m_binBoxes[binCursor[bin]++] = k; } );
+  }
+}
+
+} // namespace geosx
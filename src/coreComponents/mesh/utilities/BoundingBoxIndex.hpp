@@ -0,0 +1,240 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BoundingBoxIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_UTILITIES_BOUNDINGBOXINDEX_HPP_
+#define GEOSX_MESH_UTILITIES_BOUNDINGBOXINDEX_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class BoundingBoxIndex
+ * @brief Uniform grid of axis-aligned bounding boxes.
+ *
+ * Each box is registered in all the bins it overlaps, so that the queries (intersection with a box or
+ * a plane) only visit the boxes of the bins they touch instead of all the boxes. The boxes may be
+ * degenerate, in which case the index is a grid of points. The boxes are identified by their position
+ * in the arrays given to the constructor: mapping them to mesh objects is left to the caller.
+ */
+class BoundingBoxIndex
+{
+public:
+
+  /**
+   * @brief Build an empty index
+   */
+  BoundingBoxIndex();
+
+  /**
+   * @brief Build the index of a set of boxes
+   * @param[in] boxMin the lower corner of the boxes (number of boxes x 3)
+   * @param[in] boxMax the upper corner of the boxes (number of boxes x 3)
+   */
+  BoundingBoxIndex( array2d< real64 > boxMin,
+                    array2d< real64 > boxMax );
+
+  /**
+   * @brief Get the number of indexed boxes
+   * @return the number of boxes
+   */
+  localIndex size() const { return m_boxMin.size( 0 ); }
+
+  /**
+   * @brief Loop over the indexed boxes intersecting a box
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] boxMin the lower corner of the box
+   * @param[in] boxMax the upper corner of the box
+   * @param[in] lambda the function called as lambda( k ) on the intersecting boxes, in increasing order of k
+   */
+  template< typename LAMBDA >
+  void forBoxesIntersectingBox( real64 const ( &boxMin )[3],
+                                real64 const ( &boxMax )[3],
+                                LAMBDA && lambda ) const
+  {
+    forCandidates( boxMin, boxMax,
+                   [&]( localIndex const k ) { return intersectsBox( k, boxMin, boxMax ); },
+                   std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Loop over the indexed boxes crossed by a plane, within a box
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] normal the normal of the plane
+   * @param[in] origin a point of the plane
+   * @param[in] boxMin the lower corner of the box containing the region of interest of the plane
+   * @param[in] boxMax the upper corner of the box containing the region of interest of the plane
+   * @param[in] lambda the function called as lambda( k ) on the crossed boxes, in increasing order of k
+   */
+  template< typename LAMBDA >
+  void forBoxesCrossingPlane( real64 const ( &normal )[3],
+                              real64 const ( &origin )[3],
+                              real64 const ( &boxMin )[3],
+                              real64 const ( &boxMax )[3],
+                              LAMBDA && lambda ) const
+  {
+    forCandidates( boxMin, boxMax,
+                   [&]( localIndex const k ) { return intersectsBox( k, boxMin, boxMax ) && crossesPlane( k, normal, origin ); },
+                   std::forward< LAMBDA >( lambda ) );
+  }
+
+private:
+
+  /**
+   * @brief Get the bin containing a coordinate, clamped to the grid
+   * @param[in] dim the direction
+   * @param[in] x the coordinate
+   * @return the bin index in direction @p dim
+   */
+  localIndex getBin( integer const dim, real64 const x ) const
+  {
+    real64 const bin = std::floor( ( x - m_gridMin[dim] ) * m_invBinSize[dim] );
+    return static_cast< localIndex >( std::min( std::max( bin, 0.0 ), static_cast< real64 >( m_numBins[dim] - 1 ) ) );
+  }
+
+  /**
+   * @brief Check if an indexed box intersects a box
+   * @param[in] k the position of the box in the index
+   * @param[in] boxMin the lower corner of the box
+   * @param[in] boxMax the upper corner of the box
+   * @return true if the boxes intersect (or touch)
+   */
+  bool intersectsBox( localIndex const k,
+                      real64 const ( &boxMin )[3],
+                      real64 const ( &boxMax )[3] ) const
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      if( m_boxMin[k][d] > boxMax[d] || m_boxMax[k][d] < boxMin[d] )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Check if a plane crosses (or touches) an indexed box
+   * @param[in] k the position of the box in the index
+   * @param[in] normal the normal of the plane
+   * @param[in] origin a point of the plane
+   * @return true if the plane crosses the box
+   */
+  bool crossesPlane( localIndex const k,
+                     real64 const ( &normal )[3],
+                     real64 const ( &origin )[3] ) const
+  {
+    // distance from the box center to the plane, compared with the projection radius of the box
+    real64 distance = 0.0;
+    real64 radius = 0.0;
+    for( integer d = 0; d < 3; ++d )
+    {
+      real64 const center = 0.5 * ( m_boxMin[k][d] + m_boxMax[k][d] );
+      real64 const halfWidth = 0.5 * ( m_boxMax[k][d] - m_boxMin[k][d] );
+      distance += normal[d] * ( center - origin[d] );
+      radius += std::abs( normal[d] ) * halfWidth;
+    }
+    return std::abs( distance ) <= radius;
+  }
+
+  /**
+   * @brief Collect the boxes of the bins overlapped by a box, and call a function on those passing a filter
+   * @tparam FILTER the type of the filter
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] boxMin the lower corner of the box
+   * @param[in] boxMax the upper corner of the box
+   * @param[in] filter the function called as filter( k ) to accept or reject box k of the index
+   * @param[in] lambda the function called as lambda( k ) on the accepted boxes
+   */
+  template< typename FILTER, typename LAMBDA >
+  void forCandidates( real64 const ( &boxMin )[3],
+                      real64 const ( &boxMax )[3],
+                      FILTER && filter,
+                      LAMBDA && lambda ) const
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      if( size() == 0 || boxMax[d] < m_gridMin[d] || boxMin[d] > m_gridMax[d] )
+      {
+        return;
+      }
+    }
+
+    std::vector< localIndex > candidates;
+    for( localIndex i = getBin( 0, boxMin[0] ); i <= getBin( 0, boxMax[0] ); ++i )
+    {
+      for( localIndex j = getBin( 1, boxMin[1] ); j <= getBin( 1, boxMax[1] ); ++j )
+      {
+        for( localIndex l = getBin( 2, boxMin[2] ); l <= getBin( 2, boxMax[2] ); ++l )
+        {
+          localIndex const bin = ( i * m_numBins[1] + j ) * m_numBins[2] + l;
+          for( localIndex p = m_binOffsets[bin]; p < m_binOffsets[bin + 1]; ++p )
+          {
+            if( filter( m_binBoxes[p] ) )
+            {
+              candidates.emplace_back( m_binBoxes[p] );
+            }
+          }
+        }
+      }
+    }
+
+    // a box overlapping several bins is collected several times
+    std::sort( candidates.begin(), candidates.end() );
+    candidates.erase( std::unique( candidates.begin(), candidates.end() ), candidates.end() );
+
+    for( localIndex const k : candidates )
+    {
+      lambda( k );
+    }
+  }
+
+  /// Lower corner of the indexed boxes
+  array2d< real64 > m_boxMin;
+
+  /// Upper corner of the indexed boxes
+  array2d< real64 > m_boxMax;
+
+  /// Lower corner of the grid
+  real64 m_gridMin[3]{};
+
+  /// Upper corner of the grid
+  real64 m_gridMax[3]{};
+
+  /// Inverse of the bin size in each direction
+  real64 m_invBinSize[3]{};
+
+  /// Number of bins in each direction
+  localIndex m_numBins[3]{ 1, 1, 1 };
+
+  /// Offsets of the bins in m_binBoxes (size number of bins + 1)
+  array1d< localIndex > m_binOffsets;
+
+  /// Positions in the index of the boxes overlapping each bin
+  array1d< localIndex > m_binBoxes;
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_MESH_UTILITIES_BOUNDINGBOXINDEX_HPP_ */
@@ -0,0 +1,78 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ElementSpatialIndex.cpp
+ */
+
+#include "ElementSpatialIndex.hpp"
+
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/MeshLevel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace geosx
+{
+
+ElementSpatialIndex::ElementSpatialIndex( MeshLevel const & mesh )
+{
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+
+  localIndex numElems = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElems += subRegion.size();
+  } );
+
+  m_elemRegion.resize( numElems );
+  m_elemSubRegion.resize( numElems );
+  m_elemIndex.resize( numElems );
+  array2d< real64 > elemBoxMin( numElems, 3 );
+  array2d< real64 > elemBoxMax( numElems, 3 );
+
+  localIndex k = 0;
+  elemManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                         localIndex const esr,
+                                                                         ElementRegionBase const &,
+                                                                         CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei, ++k )
+    {
+      m_elemRegion[k] = er;
+      m_elemSubRegion[k] = esr;
+      m_elemIndex[k] = ei;
+      for( integer d = 0; d < 3; ++d )
+      {
+        elemBoxMin[k][d] = std::numeric_limits< real64 >::max();
+        elemBoxMax[k][d] = std::numeric_limits< real64 >::lowest();
+      }
+      for( localIndex a = 0; a < subRegion.numNodesPerElement(); ++a )
+      {
+        for( integer d = 0; d < 3; ++d )
+        {
+          elemBoxMin[k][d] = std::min( elemBoxMin[k][d], X[elemsToNodes[ei][a]][d] );
+          elemBoxMax[k][d] = std::max( elemBoxMax[k][d], X[elemsToNodes[ei][a]][d] );
+        }
+      }
+    }
+  } );
+
+  m_boxIndex = BoundingBoxIndex( std::move( elemBoxMin ), std::move( elemBoxMax ) );
+}
+
+} // namespace geosx
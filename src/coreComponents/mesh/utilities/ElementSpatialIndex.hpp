@@ -0,0 +1,128 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ElementSpatialIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP_
+#define GEOSX_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP_
+
+#include "mesh/utilities/BoundingBoxIndex.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+
+/**
+ * @class ElementSpatialIndex
+ * @brief Uniform grid of the bounding boxes of the cell elements of a mesh level.
+ *
+ * The bounding boxes of the elements are stored in a BoundingBoxIndex, so that the queries
+ * (point location, intersection with a box or a plane) only visit the elements of the bins they touch
+ * instead of all the elements of the mesh. The candidates are only filtered with their bounding box:
+ * the exact test (point in polyhedron, plane cutting the element, ...) is left to the caller.
+ *
+ * The index covers the locally owned and the ghost elements of all the CellElementSubRegions, and is
+ * built from the reference position of the nodes. It must be rebuilt if elements are added or moved.
+ */
+class ElementSpatialIndex
+{
+public:
+
+  /**
+   * @brief Build the index of the cell elements of a mesh level
+   * @param[in] mesh the mesh level
+   */
+  explicit ElementSpatialIndex( MeshLevel const & mesh );
+
+  /**
+   * @brief Get the number of indexed elements
+   * @return the number of elements
+   */
+  localIndex numElements() const { return m_elemIndex.size(); }
+
+  /**
+   * @brief Loop over the elements whose bounding box contains a point
+   * @tparam POINT_TYPE the type of the point coordinates
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] point the coordinates of the point
+   * @param[in] lambda the function called as lambda( er, esr, ei ), the candidates being sorted by (er, esr, ei)
+   */
+  template< typename POINT_TYPE, typename LAMBDA >
+  void forElementsContainingPoint( POINT_TYPE const & point, LAMBDA && lambda ) const
+  {
+    real64 const x[3] = { point[0], point[1], point[2] };
+    forElementsIntersectingBox( x, x, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Loop over the elements whose bounding box intersects a box
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] boxMin the lower corner of the box
+   * @param[in] boxMax the upper corner of the box
+   * @param[in] lambda the function called as lambda( er, esr, ei ), the candidates being sorted by (er, esr, ei)
+   */
+  template< typename LAMBDA >
+  void forElementsIntersectingBox( real64 const ( &boxMin )[3],
+                                   real64 const ( &boxMax )[3],
+                                   LAMBDA && lambda ) const
+  {
+    m_boxIndex.forBoxesIntersectingBox( boxMin, boxMax, [&]( localIndex const k )
+    {
+      lambda( m_elemRegion[k], m_elemSubRegion[k], m_elemIndex[k] );
+    } );
+  }
+
+  /**
+   * @brief Loop over the elements whose bounding box is crossed by a plane, within a box
+   * @tparam LAMBDA the type of the function called on each candidate
+   * @param[in] normal the normal of the plane
+   * @param[in] origin a point of the plane
+   * @param[in] boxMin the lower corner of the box containing the region of interest of the plane
+   * @param[in] boxMax the upper corner of the box containing the region of interest of the plane
+   * @param[in] lambda the function called as lambda( er, esr, ei ), the candidates being sorted by (er, esr, ei)
+   */
+  template< typename LAMBDA >
+  void forElementsCrossingPlane( real64 const ( &normal )[3],
+                                 real64 const ( &origin )[3],
+                                 real64 const ( &boxMin )[3],
+                                 real64 const ( &boxMax )[3],
+                                 LAMBDA && lambda ) const
+  {
+    m_boxIndex.forBoxesCrossingPlane( normal, origin, boxMin, boxMax, [&]( localIndex const k )
+    {
+      lambda( m_elemRegion[k], m_elemSubRegion[k], m_elemIndex[k] );
+    } );
+  }
+
+private:
+
+  /// Region index of the indexed elements
+  array1d< localIndex > m_elemRegion;
+
+  /// Subregion index of the indexed elements
+  array1d< localIndex > m_elemSubRegion;
+
+  /// Index of the indexed elements in their subregion
+  array1d< localIndex > m_elemIndex;
+
+  /// Bounding boxes of the indexed elements, identified by their position in the index
+  BoundingBoxIndex m_boxIndex;
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP_ */
@@ -99,6 +99,12 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum number of time sub-steps allowed for the solver" );
 
+  registerWrapper( viewKeysStruct::convergenceLogFileString, &m_convergenceLogFile ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of a CSV file, written by rank 0 in the output directory, with one record per nonlinear iteration "
+                    "(time step, dt, number of cuts, residual norm, line search cuts, assembly time, linear solver iterations, "
+                    "residual reduction, setup and solve times). Not written if empty." );
+
 
 
 }
@@ -83,6 +83,8 @@ public:
     static constexpr auto minNumNewtonIterationsString  = "minNumberOfNewtonIterations";
     static constexpr auto timeStepCutFactorString       = "timestepCutFactor";
 
+    static constexpr auto convergenceLogFileString      = "convergenceLogFile";
+
   } viewKeys;
 
 
@@ -159,6 +161,12 @@ public:
   /// number of times that the time-step had to be cut
   integer m_numdtAttempts;
 
+  /// number of line search cuts applied in the current nonlinear iteration
+  integer m_numLineSearchCuts = 0;
+
+  /// Name of the CSV file recording the convergence of the nonlinear and linear solves (not written if empty)
+  string m_convergenceLogFile;
+
 };
 
 ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction,
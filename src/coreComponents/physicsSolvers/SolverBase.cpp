@@ -15,7 +15,10 @@
 #include "SolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "common/Path.hpp"
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "mesh/DomainPartition.hpp"
@@ -188,6 +191,7 @@ bool SolverBase::execute( real64 const time_n,
                           DomainPartition & domain )
 {
   GEOSX_MARK_FUNCTION;
+  GEOSX_MARK_SCOPE_STRING( getName() );
   real64 dtRemaining = dt;
   real64 nextDt = dt;
 
@@ -261,7 +265,7 @@ void SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt,
 
 real64 SolverBase::linearImplicitStep( real64 const & time_n,
                                        real64 const & dt,
-                                       integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                       integer const cycleNumber,
                                        DomainPartition & domain )
 {
   // call setup for physics solver. Pre step allocations etc.
@@ -272,7 +276,10 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   m_localMatrix.zero();
   m_rhs.zero();
 
+  real64 assemblyTime = 0.0;
   {
+    GEOSX_MARK_SCOPE( assembly );
+    Stopwatch timer( assemblyTime );
     arrayView1d< real64 > const localRhs = m_rhs.open();
 
     // call assemble to fill the matrix and the rhs
@@ -320,11 +327,16 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   // Output the linear system solution for debugging purposes
   debugOutputSolution( 0.0, 0, 0, m_solution );
 
+  logConvergence( time_n, dt, cycleNumber, std::numeric_limits< real64 >::quiet_NaN(), assemblyTime, true, m_linearSolverResult.success() );
+
   // apply the system solution to the fields/variables
   applySystemSolution( m_dofManager, m_solution.values(), 1.0, domain );
 
   // update non-primary variables (constitutive models)
-  updateState( domain );
+  {
+    GEOSX_MARK_SCOPE( propertyUpdate );
+    updateState( domain );
+  }
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   implicitStepComplete( time_n, dt, domain );
@@ -366,6 +378,7 @@ bool SolverBase::lineSearch( real64 const & time_n,
     // have values of -0.5, -0.25, -0.125, ...
     localScaleFactor *= lineSearchCutFactor;
     cumulativeScale += localScaleFactor;
+    m_nonlinearSolverParameters.m_numLineSearchCuts = lineSearchIteration + 1;
 
     if( !checkSystemSolution( domain, dofManager, solution.values(), localScaleFactor ) )
     {
@@ -510,7 +523,10 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       m_localMatrix.zero();
       m_rhs.zero();
 
+      real64 assemblyTime = 0.0;
       {
+        GEOSX_MARK_SCOPE( assembly );
+        Stopwatch timer( assemblyTime );
         arrayView1d< real64 > const localRhs = m_rhs.open();
 
         // call assemble to fill the matrix and the rhs
@@ -560,10 +576,12 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       if( residualNorm < newtonTol && newtonIter >= minNewtonIter )
       {
         isConverged = 1;
+        logConvergence( time_n, stepDt, cycleNumber, residualNorm, assemblyTime, false, true );
         break;
       }
 
       // do line search in case residual has increased
+      m_nonlinearSolverParameters.m_numLineSearchCuts = 0;
       if( m_nonlinearSolverParameters.m_lineSearchAction != NonlinearSolverParameters::LineSearchAction::None
           && residualNorm > lastResidual )
       {
@@ -619,6 +637,8 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       // Output the linear system solution for debugging purposes
       debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
 
+      logConvergence( time_n, stepDt, cycleNumber, residualNorm, assemblyTime, true, false );
+
       scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_solution.values() );
 
       if( !checkSystemSolution( domain, m_dofManager, m_solution.values(), scaleFactor ) )
@@ -632,7 +652,10 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, domain );
 
       // update non-primary variables (constitutive models)
-      updateState( domain );
+      {
+        GEOSX_MARK_SCOPE( propertyUpdate );
+        updateState( domain );
+      }
 
       lastResidual = residualNorm;
     }
@@ -819,6 +842,48 @@ void SolverBase::debugOutputSolution( real64 const & time,
                        getLogLevel() >= 3 );
 }
 
+void SolverBase::logConvergence( real64 const & time,
+                                 real64 const & dt,
+                                 integer const cycleNumber,
+                                 real64 const residualNorm,
+                                 real64 const assemblyTime,
+                                 bool const linearSolved,
+                                 bool const converged )
+{
+  string const & fileName = m_nonlinearSolverParameters.m_convergenceLogFile;
+  if( fileName.empty() || MpiWrapper::commRank( MPI_COMM_GEOSX ) != 0 )
+  {
+    return;
+  }
+
+  if( !m_convergenceLog )
+  {
+    string const filePath = joinPath( OutputBase::getOutputDirectory(), fileName );
+    m_convergenceLog = std::make_unique< std::ofstream >( filePath );
+    GEOSX_THROW_IF( !m_convergenceLog->is_open(),
+                    getName() << ": could not open the convergence log file " << filePath,
+                    InputError );
+    *m_convergenceLog << "solver,cycle,time,dt,dtCuts,newtonIter,residualNorm,lineSearchCuts,assemblyTime,"
+                         "linearIterations,linearResidualReduction,linearSetupTime,linearSolveTime,converged\n";
+  }
+
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+  *m_convergenceLog << GEOSX_FMT( "{},{},{},{},{},{},{},{},{}",
+                                  getName(), cycleNumber, time, dt, params.m_numdtAttempts,
+                                  params.m_numNewtonIterations, residualNorm, params.m_numLineSearchCuts, assemblyTime );
+  if( linearSolved )
+  {
+    *m_convergenceLog << GEOSX_FMT( ",{},{},{},{}",
+                                    m_linearSolverResult.numIterations, m_linearSolverResult.residualReduction,
+                                    m_linearSolverResult.setupTime, m_linearSolverResult.solveTime );
+  }
+  else
+  {
+    *m_convergenceLog << ",,,,";
+  }
+  *m_convergenceLog << ',' << ( converged ? 1 : 0 ) << std::endl;
+}
+
 real64
 SolverBase::calculateResidualNorm( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                    DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
@@ -841,16 +906,31 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
     std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
-    solver->setup( matrix );
-    solver->solve( rhs, solution );
+    {
+      GEOSX_MARK_SCOPE( linearSetup );
+      solver->setup( matrix );
+    }
+    {
+      GEOSX_MARK_SCOPE( linearSolve );
+      solver->solve( rhs, solution );
+    }
     m_linearSolverResult = solver->result();
   }
   else
   {
-    m_precond->setup( matrix );
+    real64 setupTime = 0.0;
+    {
+      GEOSX_MARK_SCOPE( linearSetup );
+      Stopwatch timer( setupTime );
+      m_precond->setup( matrix );
+    }
     std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
-    solver->solve( rhs, solution );
+    {
+      GEOSX_MARK_SCOPE( linearSolve );
+      solver->solve( rhs, solution );
+    }
     m_linearSolverResult = solver->result();
+    m_linearSolverResult.setupTime = setupTime;
   }
 
   if( params.stopIfError )
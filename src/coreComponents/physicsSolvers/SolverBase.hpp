@@ -27,6 +27,7 @@
 #include "physicsSolvers/LinearSolverParameters.hpp"
 
 
+#include <fstream>
 #include <limits>
 
 namespace geosx
@@ -362,6 +363,28 @@ public:
                        integer const nonlinearIteration,
                        ParallelVector const & solution ) const;
 
+  /**
+   * @brief Append a record to the convergence log, if a convergence log file has been requested.
+   * @param time beginning-of-step time
+   * @param dt time step size of the current attempt
+   * @param cycleNumber event cycle number
+   * @param residualNorm norm of the residual at the beginning of the nonlinear iteration
+   * @param assemblyTime time (in seconds) spent assembling the system
+   * @param linearSolved whether a linear system was solved in this iteration (m_linearSolverResult is then recorded)
+   * @param converged whether the nonlinear iteration satisfied the convergence criterion
+   *
+   * The log is written by rank 0 only. The number of time step cuts, the nonlinear iteration number
+   * and the number of line search cuts are taken from the nonlinear solver parameters.
+   */
+  void
+  logConvergence( real64 const & time,
+                  real64 const & dt,
+                  integer const cycleNumber,
+                  real64 const residualNorm,
+                  real64 const assemblyTime,
+                  bool const linearSolved,
+                  bool const converged );
+
   /**
    * @brief calculate the norm of the global system residual
    * @param rhs the system right-hand side vector
@@ -686,6 +709,9 @@ protected:
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
+  /// Stream of the convergence log (opened on rank 0 at the first record)
+  std::unique_ptr< std::ofstream > m_convergenceLog;
+
   std::function< void( CRSMatrix< real64, globalIndex >, array1d< real64 > ) > m_assemblyCallback;
 
   /// Map containing the array of target regions (value) for each MeshBody (key).
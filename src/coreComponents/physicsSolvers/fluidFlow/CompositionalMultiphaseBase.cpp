@@ -551,16 +551,115 @@ void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & da
   }
 }
 
+namespace
+{
+
+/**
+ * @brief Launch the fused fluid state update kernel on the device policy of the saturation-dependent models
+ * @return true, since the fluid state has been updated
+ */
+template< typename FLUID_WRAPPER >
+bool launchFluidStateUpdate( std::true_type,
+                             integer const numComp,
+                             integer const numPhase,
+                             ObjectManagerBase & subRegion,
+                             MultiFluidBase const & fluid,
+                             FLUID_WRAPPER const & fluidWrapper,
+                             RelativePermeabilityBase & relPerm,
+                             CapillaryPressureBase * const capPressure )
+{
+  constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
+  {
+    using RelPermType = TYPEOFREF( castedRelPerm );
+    typename RelPermType::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+
+    auto launchFusedKernel = [&] ( auto const & capPresWrapper )
+    {
+      using KernelType = FluidStateUpdateKernel< FLUID_WRAPPER,
+                                                 typename RelPermType::KernelWrapper,
+                                                 std::decay_t< decltype( capPresWrapper ) > >;
+      KernelType kernel( numComp, numPhase, subRegion, fluid,
+                         fluidWrapper, relPermWrapper, capPresWrapper );
+      KernelType::template launch< parallelDevicePolicy<> >( subRegion.size(), kernel );
+    };
+
+    if( capPressure != nullptr )
+    {
+      constitutiveUpdatePassThru( *capPressure, [&] ( auto & castedCapPres )
+      {
+        launchFusedKernel( castedCapPres.createKernelWrapper() );
+      } );
+    }
+    else
+    {
+      launchFusedKernel( NoOpCapPressureWrapper{} );
+    }
+  } );
+  return true;
+}
+
+/**
+ * @brief Fallback for the fluids running with another policy: the updates are launched separately by the caller
+ * @return false, since nothing has been updated
+ */
+template< typename FLUID_WRAPPER >
+bool launchFluidStateUpdate( std::false_type,
+                             integer const,
+                             integer const,
+                             ObjectManagerBase &,
+                             MultiFluidBase const &,
+                             FLUID_WRAPPER const &,
+                             RelativePermeabilityBase &,
+                             CapillaryPressureBase * const )
+{
+  return false;
+}
+
+}
+
 void CompositionalMultiphaseBase::updateFluidState( ObjectManagerBase & subRegion ) const
 {
   GEOSX_MARK_FUNCTION;
 
   updateComponentFraction( subRegion );
-  updateFluidModel( subRegion );
-  updatePhaseVolumeFraction( subRegion );
-  updateRelPermModel( subRegion );
+
+  string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
+  MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
+
+  string const & relPermName = subRegion.getReference< string >( viewKeyStruct::relPermNamesString() );
+  RelativePermeabilityBase & relPerm = getConstitutiveModel< RelativePermeabilityBase >( subRegion, relPermName );
+
+  CapillaryPressureBase * capPressure = nullptr;
+  if( m_hasCapPressure )
+  {
+    string const & capPressureName = subRegion.getReference< string >( viewKeyStruct::capPressureNamesString() );
+    capPressure = &getConstitutiveModel< CapillaryPressureBase >( subRegion, capPressureName );
+  }
+
+  // the fluid, phase volume fraction, relperm and capillary pressure updates are fused in a single pass
+  // over the elements when the fluid runs with the device policy of the saturation-dependent models;
+  // the fluids restricted to another policy (e.g., serial) keep separate launches, so that they do not
+  // serialize the other updates, and only instantiate the fused kernel for the fluids that use it
+  bool isFused = false;
+  constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+    using UseFusedKernel = std::is_same< typename FluidType::exec_policy, parallelDevicePolicy<> >;
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    isFused = launchFluidStateUpdate( UseFusedKernel{}, m_numComponents, m_numPhases, subRegion, fluid,
+                                      fluidWrapper, relPerm, capPressure );
+  } );
+
+  if( !isFused )
+  {
+    updateFluidModel( subRegion );
+    updatePhaseVolumeFraction( subRegion );
+    updateRelPermModel( subRegion );
+    updateCapPressureModel( subRegion );
+  }
+
   updatePhaseMobility( subRegion );
-  updateCapPressureModel( subRegion );
   // note: for now, thermal conductivity is treated explicitly, so no update here
 }
 
@@ -154,6 +154,12 @@ public:
    */
   virtual void updatePhaseMobility( ObjectManagerBase & dataGroup ) const = 0;
 
+  /**
+   * @brief Recompute the fluid state (fluid properties, saturations, relperms, capillary pressures, mobilities)
+   * @param dataGroup the group storing the required fields
+   * @note the constitutive updates are fused in a single kernel to traverse the element data once,
+   *       unless the fluid model is restricted to a host policy that would serialize the other updates
+   */
   void updateFluidState( ObjectManagerBase & dataGroup ) const;
 
   virtual void updateState( DomainPartition & domain ) override final;
@@ -248,6 +248,103 @@ public:
 
 /******************************** PhaseVolumeFractionKernel ********************************/
 
+/**
+ * @brief Compute the phase volume fractions and their derivatives in an element
+ * @tparam MAX_COMP compile-time upper bound on the number of components (sizes the work array)
+ * @tparam FUNC the type of the function that can be used to customize the computation
+ * @param[in] numComp the number of fluid components
+ * @param[in] numPhase the number of fluid phases
+ * @param[in] compDens the component densities
+ * @param[in] dCompDens the component density increments
+ * @param[in] dCompFrac_dCompDens the derivatives of component fractions wrt component densities
+ * @param[in] phaseDens the phase densities
+ * @param[in] dPhaseDens the derivatives of phase densities
+ * @param[in] phaseFrac the phase fractions
+ * @param[in] dPhaseFrac the derivatives of phase fractions
+ * @param[out] phaseVolFrac the phase volume fractions
+ * @param[out] dPhaseVolFrac_dPres the derivatives of phase volume fractions wrt pressure
+ * @param[out] dPhaseVolFrac_dComp the derivatives of phase volume fractions wrt component densities
+ * @param[in] phaseVolFractionKernelOp the function used to customize the computation
+ */
+template< integer MAX_COMP, typename FUNC >
+GEOSX_HOST_DEVICE
+inline void
+computePhaseVolumeFraction( integer const numComp,
+                            integer const numPhase,
+                            arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & compDens,
+                            arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & dCompDens,
+                            arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const & dCompFrac_dCompDens,
+                            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseDens,
+                            arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dPhaseDens,
+                            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseFrac,
+                            arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dPhaseFrac,
+                            arraySlice1d< real64, compflow::USD_PHASE - 1 > const & phaseVolFrac,
+                            arraySlice1d< real64, compflow::USD_PHASE - 1 > const & dPhaseVolFrac_dPres,
+                            arraySlice2d< real64, compflow::USD_PHASE_DC - 1 > const & dPhaseVolFrac_dComp,
+                            FUNC && phaseVolFractionKernelOp )
+{
+  using Deriv = multifluid::DerivativeOffset;
+
+  real64 work[MAX_COMP]{};
+
+  // compute total density from component partial densities
+  real64 totalDensity = 0.0;
+  real64 const dTotalDens_dCompDens = 1.0;
+  for( integer ic = 0; ic < numComp; ++ic )
+  {
+    totalDensity += compDens[ic] + dCompDens[ic];
+  }
+
+  for( integer ip = 0; ip < numPhase; ++ip )
+  {
+
+    // set the saturation to zero if the phase is absent
+    bool const phaseExists = (phaseFrac[ip] > 0);
+    if( !phaseExists )
+    {
+      phaseVolFrac[ip] = 0.;
+      dPhaseVolFrac_dPres[ip] = 0.;
+      for( integer jc = 0; jc < numComp; ++jc )
+      {
+        dPhaseVolFrac_dComp[ip][jc] = 0.;
+      }
+      continue;
+    }
+
+    // Expression for volume fractions: S_p = (nu_p / rho_p) * rho_t
+    real64 const phaseDensInv = 1.0 / phaseDens[ip];
+
+    // compute saturation and derivatives except multiplying by the total density
+    phaseVolFrac[ip] = phaseFrac[ip] * phaseDensInv;
+
+    dPhaseVolFrac_dPres[ip] =
+      (dPhaseFrac[ip][Deriv::dP] - phaseVolFrac[ip] * dPhaseDens[ip][Deriv::dP]) * phaseDensInv;
+
+    for( integer jc = 0; jc < numComp; ++jc )
+    {
+      dPhaseVolFrac_dComp[ip][jc] =
+        (dPhaseFrac[ip][Deriv::dC+jc] - phaseVolFrac[ip] * dPhaseDens[ip][Deriv::dC+jc]) * phaseDensInv;
+    }
+
+    // apply chain rule to convert derivatives from global component fractions to densities
+    applyChainRuleInPlace( numComp, dCompFrac_dCompDens, dPhaseVolFrac_dComp[ip], work );
+
+    // call the lambda in the phase loop to allow the reuse of the phaseVolFrac and totalDensity
+    // possible use: assemble the derivatives wrt temperature
+    phaseVolFractionKernelOp( ip, phaseVolFrac[ip], totalDensity );
+
+    // now finalize the computation by multiplying by total density
+    for( integer jc = 0; jc < numComp; ++jc )
+    {
+      dPhaseVolFrac_dComp[ip][jc] *= totalDensity;
+      dPhaseVolFrac_dComp[ip][jc] += phaseVolFrac[ip] * dTotalDens_dCompDens;
+    }
+
+    phaseVolFrac[ip] *= totalDensity;
+    dPhaseVolFrac_dPres[ip] *= totalDensity;
+  }
+}
+
 /**
  * @class PhaseVolumeFractionKernel
  * @tparam NUM_COMP number of fluid components
@@ -296,77 +393,19 @@ public:
   void compute( localIndex const ei,
                 FUNC && phaseVolFractionKernelOp = NoOpFunc{} ) const
   {
-    using Deriv = multifluid::DerivativeOffset;
-
-    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compDens = m_compDens[ei];
-    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const dCompDens = m_dCompDens[ei];
-    arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const dCompFrac_dCompDens = m_dCompFrac_dCompDens[ei];
-    arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const phaseDens = m_phaseDens[ei][0];
-    arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const dPhaseDens = m_dPhaseDens[ei][0];
-    arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const phaseFrac = m_phaseFrac[ei][0];
-    arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const dPhaseFrac = m_dPhaseFrac[ei][0];
-    arraySlice1d< real64, compflow::USD_PHASE - 1 > const phaseVolFrac = m_phaseVolFrac[ei];
-    arraySlice1d< real64, compflow::USD_PHASE - 1 > const dPhaseVolFrac_dPres = m_dPhaseVolFrac_dPres[ei];
-    arraySlice2d< real64, compflow::USD_PHASE_DC - 1 > const dPhaseVolFrac_dComp = m_dPhaseVolFrac_dComp[ei];
-
-    real64 work[numComp]{};
-
-    // compute total density from component partial densities
-    real64 totalDensity = 0.0;
-    real64 const dTotalDens_dCompDens = 1.0;
-    for( integer ic = 0; ic < numComp; ++ic )
-    {
-      totalDensity += compDens[ic] + dCompDens[ic];
-    }
-
-    for( integer ip = 0; ip < numPhase; ++ip )
-    {
-
-      // set the saturation to zero if the phase is absent
-      bool const phaseExists = (phaseFrac[ip] > 0);
-      if( !phaseExists )
-      {
-        phaseVolFrac[ip] = 0.;
-        dPhaseVolFrac_dPres[ip] = 0.;
-        for( integer jc = 0; jc < numComp; ++jc )
-        {
-          dPhaseVolFrac_dComp[ip][jc] = 0.;
-        }
-        continue;
-      }
-
-      // Expression for volume fractions: S_p = (nu_p / rho_p) * rho_t
-      real64 const phaseDensInv = 1.0 / phaseDens[ip];
-
-      // compute saturation and derivatives except multiplying by the total density
-      phaseVolFrac[ip] = phaseFrac[ip] * phaseDensInv;
-
-      dPhaseVolFrac_dPres[ip] =
-        (dPhaseFrac[ip][Deriv::dP] - phaseVolFrac[ip] * dPhaseDens[ip][Deriv::dP]) * phaseDensInv;
-
-      for( integer jc = 0; jc < numComp; ++jc )
-      {
-        dPhaseVolFrac_dComp[ip][jc] =
-          (dPhaseFrac[ip][Deriv::dC+jc] - phaseVolFrac[ip] * dPhaseDens[ip][Deriv::dC+jc]) * phaseDensInv;
-      }
-
-      // apply chain rule to convert derivatives from global component fractions to densities
-      applyChainRuleInPlace( numComp, dCompFrac_dCompDens, dPhaseVolFrac_dComp[ip], work );
-
-      // call the lambda in the phase loop to allow the reuse of the phaseVolFrac and totalDensity
-      // possible use: assemble the derivatives wrt temperature
-      phaseVolFractionKernelOp( ip, phaseVolFrac[ip], totalDensity );
-
-      // now finalize the computation by multiplying by total density
-      for( integer jc = 0; jc < numComp; ++jc )
-      {
-        dPhaseVolFrac_dComp[ip][jc] *= totalDensity;
-        dPhaseVolFrac_dComp[ip][jc] += phaseVolFrac[ip] * dTotalDens_dCompDens;
-      }
-
-      phaseVolFrac[ip] *= totalDensity;
-      dPhaseVolFrac_dPres[ip] *= totalDensity;
-    }
+    computePhaseVolumeFraction< numComp >( numComp,
+                                           numPhase,
+                                           m_compDens[ei],
+                                           m_dCompDens[ei],
+                                           m_dCompFrac_dCompDens[ei],
+                                           m_phaseDens[ei][0],
+                                           m_dPhaseDens[ei][0],
+                                           m_phaseFrac[ei][0],
+                                           m_dPhaseFrac[ei][0],
+                                           m_phaseVolFrac[ei],
+                                           m_dPhaseVolFrac_dPres[ei],
+                                           m_dPhaseVolFrac_dComp[ei],
+                                           std::forward< FUNC >( phaseVolFractionKernelOp ) );
   }
 
 protected:
@@ -442,6 +481,21 @@ public:
 
 struct FluidUpdateKernel
 {
+  /**
+   * @brief Tells whether the cells can be updated in batches, that is, whether the fluid wrapper
+   *        provides updateBatch (and batchSize) and the policy runs on host
+   * @tparam POLICY the execution policy
+   * @tparam FLUID_WRAPPER the type of the fluid kernel wrapper
+   */
+  template< typename POLICY, typename FLUID_WRAPPER, typename = void >
+  struct UseBatchedUpdate : std::false_type
+  {};
+
+  template< typename POLICY, typename FLUID_WRAPPER >
+  struct UseBatchedUpdate< POLICY, FLUID_WRAPPER, std::enable_if_t< ( FLUID_WRAPPER::batchSize > 0 ) > >
+    : std::integral_constant< bool, std::is_same< POLICY, serialPolicy >::value || std::is_same< POLICY, parallelHostPolicy >::value >
+  {};
+
   template< typename POLICY, typename FLUID_WRAPPER >
   static void
   launch( localIndex const size,
@@ -450,13 +504,7 @@ struct FluidUpdateKernel
           arrayView1d< real64 const > const & temp,
           arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
   {
-    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
-    {
-      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
-      {
-        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
-      }
-    } );
+    launch< POLICY >( size, fluidWrapper, pres, arrayView1d< real64 const >(), temp, compFrac );
   }
 
   template< typename POLICY, typename FLUID_WRAPPER >
@@ -468,13 +516,7 @@ struct FluidUpdateKernel
           arrayView1d< real64 const > const & temp,
           arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
   {
-    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
-    {
-      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
-      {
-        fluidWrapper.update( k, q, pres[k] + dPres[k], temp[k], compFrac[k] );
-      }
-    } );
+    launchImpl< POLICY >( UseBatchedUpdate< POLICY, FLUID_WRAPPER >{}, size, fluidWrapper, pres, dPres, temp, compFrac );
   }
 
   template< typename POLICY, typename FLUID_WRAPPER >
@@ -513,6 +555,67 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+private:
+
+  /**
+   * @brief Update the fluid properties one cell at a time
+   * @param[in] dPres the pressure increments, or an empty view if the pressures are already up to date
+   */
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launchImpl( std::false_type,
+              localIndex const size,
+              FLUID_WRAPPER const & fluidWrapper,
+              arrayView1d< real64 const > const & pres,
+              arrayView1d< real64 const > const & dPres,
+              arrayView1d< real64 const > const & temp,
+              arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    bool const addDeltaPres = !dPres.empty();
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 const pressure = addDeltaPres ? pres[k] + dPres[k] : pres[k];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pressure, temp[k], compFrac[k] );
+      }
+    } );
+  }
+
+  /**
+   * @brief Update the fluid properties by batches of FLUID_WRAPPER::batchSize consecutive cells
+   * @param[in] dPres the pressure increments, or an empty view if the pressures are already up to date
+   */
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launchImpl( std::true_type,
+              localIndex const size,
+              FLUID_WRAPPER const & fluidWrapper,
+              arrayView1d< real64 const > const & pres,
+              arrayView1d< real64 const > const & dPres,
+              arrayView1d< real64 const > const & temp,
+              arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    localIndex constexpr batchSize = FLUID_WRAPPER::batchSize;
+    localIndex const numBatches = ( size + batchSize - 1 ) / batchSize;
+    bool const addDeltaPres = !dPres.empty();
+    forAll< POLICY >( numBatches, [=] ( localIndex const b )
+    {
+      localIndex const firstElem = b * batchSize;
+      localIndex const numElems = ( size - firstElem < batchSize ) ? size - firstElem : batchSize;
+
+      real64 pressure[batchSize]{};
+      real64 temperature[batchSize]{};
+      for( localIndex i = 0; i < numElems; ++i )
+      {
+        localIndex const k = firstElem + i;
+        pressure[i] = addDeltaPres ? pres[k] + dPres[k] : pres[k];
+        temperature[i] = temp[k];
+      }
+      fluidWrapper.updateBatch( firstElem, numElems, pressure, temperature, compFrac );
+    } );
+  }
 };
 
 /******************************** RelativePermeabilityUpdateKernel ********************************/
@@ -587,6 +690,245 @@ struct CapillaryPressureUpdateKernel
   }
 };
 
+/******************************** FluidStateUpdateKernel ********************************/
+
+/**
+ * @brief Stand-in for the capillary pressure kernel wrapper when capillary pressure is disabled
+ * @struct NoOpCapPressureWrapper
+ */
+struct NoOpCapPressureWrapper
+{
+  GEOSX_HOST_DEVICE
+  constexpr localIndex numGauss() const { return 0; }
+
+  template< typename ... Ts >
+  GEOSX_HOST_DEVICE
+  constexpr void
+  update( Ts && ... ) const {}
+};
+
+/**
+ * @class FluidStateUpdateKernel
+ * @tparam FLUID_WRAPPER the type of the fluid kernel wrapper
+ * @tparam RELPERM_WRAPPER the type of the relative permeability kernel wrapper
+ * @tparam CAPPRES_WRAPPER the type of the capillary pressure kernel wrapper
+ * @brief Fused kernel updating, element by element, the fluid properties, the phase volume fractions,
+ *   the relative permeabilities and the capillary pressures, so that each element is streamed through memory once
+ * @note On host, the fluids providing updateBatch are evaluated by batches of FLUID_WRAPPER::batchSize elements
+ *   (see FluidUpdateKernel::UseBatchedUpdate), followed by the saturation-dependent updates of the batch
+ */
+template< typename FLUID_WRAPPER, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+class FluidStateUpdateKernel
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] numComp the number of fluid components
+   * @param[in] numPhase the number of fluid phases
+   * @param[in] subRegion the element subregion
+   * @param[in] fluid the fluid model
+   * @param[in] fluidWrapper the fluid kernel wrapper
+   * @param[in] relPermWrapper the relative permeability kernel wrapper
+   * @param[in] capPresWrapper the capillary pressure kernel wrapper
+   */
+  FluidStateUpdateKernel( integer const numComp,
+                          integer const numPhase,
+                          ObjectManagerBase & subRegion,
+                          MultiFluidBase const & fluid,
+                          FLUID_WRAPPER const & fluidWrapper,
+                          RELPERM_WRAPPER const & relPermWrapper,
+                          CAPPRES_WRAPPER const & capPresWrapper )
+    : m_numComp( numComp ),
+    m_numPhase( numPhase ),
+    m_fluidWrapper( fluidWrapper ),
+    m_relPermWrapper( relPermWrapper ),
+    m_capPresWrapper( capPresWrapper ),
+    m_pres( subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >() ),
+    m_dPres( subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >() ),
+    m_temp( subRegion.getExtrinsicData< extrinsicMeshData::flow::temperature >() ),
+    m_compFrac( subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompFraction >() ),
+    m_phaseVolFrac( subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >() ),
+    m_dPhaseVolFrac_dPres( subRegion.getExtrinsicData< extrinsicMeshData::flow::dPhaseVolumeFraction_dPressure >() ),
+    m_dPhaseVolFrac_dComp( subRegion.getExtrinsicData< extrinsicMeshData::flow::dPhaseVolumeFraction_dGlobalCompDensity >() ),
+    m_compDens( subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >() ),
+    m_dCompDens( subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >() ),
+    m_dCompFrac_dCompDens( subRegion.getExtrinsicData< extrinsicMeshData::flow::dGlobalCompFraction_dGlobalCompDensity >() ),
+    m_phaseFrac( fluid.phaseFraction() ),
+    m_dPhaseFrac( fluid.dPhaseFraction() ),
+    m_phaseDens( fluid.phaseDensity() ),
+    m_dPhaseDens( fluid.dPhaseDensity() )
+  {}
+
+  /**
+   * @brief Update the fluid state in an element
+   * @param[in] ei the element index
+   */
+  GEOSX_HOST_DEVICE
+  void compute( localIndex const ei ) const
+  {
+    // 1. fluid properties at the new pressure and composition
+    for( localIndex q = 0; q < m_fluidWrapper.numGauss(); ++q )
+    {
+      m_fluidWrapper.update( ei, q, m_pres[ei] + m_dPres[ei], m_temp[ei], m_compFrac[ei] );
+    }
+
+    computeSaturationDependentProperties( ei );
+  }
+
+  /**
+   * @brief Update the fluid state in a batch of consecutive elements
+   * @param[in] firstElem the index of the first element of the batch
+   * @param[in] numElems the number of elements in the batch, at most FLUID_WRAPPER::batchSize
+   */
+  void computeBatch( localIndex const firstElem,
+                     localIndex const numElems ) const
+  {
+    localIndex constexpr batchSize = FLUID_WRAPPER::batchSize;
+
+    // 1. fluid properties at the new pressure and composition, evaluated for the whole batch
+    real64 pressure[batchSize]{};
+    real64 temperature[batchSize]{};
+    for( localIndex i = 0; i < numElems; ++i )
+    {
+      localIndex const ei = firstElem + i;
+      pressure[i] = m_pres[ei] + m_dPres[ei];
+      temperature[i] = m_temp[ei];
+    }
+    m_fluidWrapper.updateBatch( firstElem, numElems, pressure, temperature, m_compFrac );
+
+    for( localIndex i = 0; i < numElems; ++i )
+    {
+      computeSaturationDependentProperties( firstElem + i );
+    }
+  }
+
+  /**
+   * @brief Update the phase volume fractions and the saturation-dependent properties in an element
+   * @param[in] ei the element index
+   */
+  GEOSX_HOST_DEVICE
+  void computeSaturationDependentProperties( localIndex const ei ) const
+  {
+    // 2. phase volume fractions from the freshly computed phase fractions and densities
+    computePhaseVolumeFraction< MultiFluidBase::MAX_NUM_COMPONENTS >( m_numComp,
+                                                                      m_numPhase,
+                                                                      m_compDens[ei],
+                                                                      m_dCompDens[ei],
+                                                                      m_dCompFrac_dCompDens[ei],
+                                                                      m_phaseDens[ei][0],
+                                                                      m_dPhaseDens[ei][0],
+                                                                      m_phaseFrac[ei][0],
+                                                                      m_dPhaseFrac[ei][0],
+                                                                      m_phaseVolFrac[ei],
+                                                                      m_dPhaseVolFrac_dPres[ei],
+                                                                      m_dPhaseVolFrac_dComp[ei],
+                                                                      NoOpFunc{} );
+
+    // 3. saturation-dependent properties
+    for( localIndex q = 0; q < m_relPermWrapper.numGauss(); ++q )
+    {
+      m_relPermWrapper.update( ei, q, m_phaseVolFrac[ei] );
+    }
+    for( localIndex q = 0; q < m_capPresWrapper.numGauss(); ++q )
+    {
+      m_capPresWrapper.update( ei, q, m_phaseVolFrac[ei] );
+    }
+  }
+
+  /**
+   * @brief Performs the kernel launch
+   * @tparam POLICY the policy used in the RAJA kernels
+   * @param[in] numElems the number of elements
+   * @param[in] kernelComponent the kernel component providing access to the compute function
+   */
+  template< typename POLICY >
+  static void
+  launch( localIndex const numElems,
+          FluidStateUpdateKernel const & kernelComponent )
+  {
+    launchImpl< POLICY >( FluidUpdateKernel::UseBatchedUpdate< POLICY, FLUID_WRAPPER >{}, numElems, kernelComponent );
+  }
+
+protected:
+
+  /**
+   * @brief Launch the kernel one element at a time
+   * @tparam POLICY the policy used in the RAJA kernels
+   * @param[in] numElems the number of elements
+   * @param[in] kernelComponent the kernel component providing access to the compute function
+   */
+  template< typename POLICY >
+  static void
+  launchImpl( std::false_type,
+              localIndex const numElems,
+              FluidStateUpdateKernel const & kernelComponent )
+  {
+    forAll< POLICY >( numElems, [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      kernelComponent.compute( ei );
+    } );
+  }
+
+  /**
+   * @brief Launch the kernel by batches of FLUID_WRAPPER::batchSize consecutive elements
+   * @tparam POLICY the policy used in the RAJA kernels
+   * @param[in] numElems the number of elements
+   * @param[in] kernelComponent the kernel component providing access to the computeBatch function
+   */
+  template< typename POLICY >
+  static void
+  launchImpl( std::true_type,
+              localIndex const numElems,
+              FluidStateUpdateKernel const & kernelComponent )
+  {
+    localIndex constexpr batchSize = FLUID_WRAPPER::batchSize;
+    localIndex const numBatches = ( numElems + batchSize - 1 ) / batchSize;
+    forAll< POLICY >( numBatches, [=] ( localIndex const b )
+    {
+      localIndex const firstElem = b * batchSize;
+      localIndex const batchElems = ( numElems - firstElem < batchSize ) ? numElems - firstElem : batchSize;
+      kernelComponent.computeBatch( firstElem, batchElems );
+    } );
+  }
+
+  /// Number of fluid components
+  integer const m_numComp;
+
+  /// Number of fluid phases
+  integer const m_numPhase;
+
+  /// Constitutive kernel wrappers
+  FLUID_WRAPPER const m_fluidWrapper;
+  RELPERM_WRAPPER const m_relPermWrapper;
+  CAPPRES_WRAPPER const m_capPresWrapper;
+
+  /// Views on primary variables
+  arrayView1d< real64 const > m_pres;
+  arrayView1d< real64 const > m_dPres;
+  arrayView1d< real64 const > m_temp;
+  arrayView2d< real64 const, compflow::USD_COMP > m_compFrac;
+
+  /// Views on phase volume fractions
+  arrayView2d< real64, compflow::USD_PHASE > m_phaseVolFrac;
+  arrayView2d< real64, compflow::USD_PHASE > m_dPhaseVolFrac_dPres;
+  arrayView3d< real64, compflow::USD_PHASE_DC > m_dPhaseVolFrac_dComp;
+
+  /// Views on component densities
+  arrayView2d< real64 const, compflow::USD_COMP > m_compDens;
+  arrayView2d< real64 const, compflow::USD_COMP > m_dCompDens;
+  arrayView3d< real64 const, compflow::USD_COMP_DC > m_dCompFrac_dCompDens;
+
+  /// Views on phase fractions
+  arrayView3d< real64 const, multifluid::USD_PHASE > m_phaseFrac;
+  arrayView4d< real64 const, multifluid::USD_PHASE_DC > m_dPhaseFrac;
+
+  /// Views on phase densities
+  arrayView3d< real64 const, multifluid::USD_PHASE > m_phaseDens;
+  arrayView4d< real64 const, multifluid::USD_PHASE_DC > m_dPhaseDens;
+
+};
+
 /******************************** ElementBasedAssemblyKernel ********************************/
 
 /**
@@ -482,76 +482,12 @@ void CompositionalMultiphaseWell::updateComponentFraction( WellElementSubRegion
 
 }
 
-void CompositionalMultiphaseWell::updateBHPForConstraint( WellElementSubRegion & subRegion )
+void CompositionalMultiphaseWell::updateReferenceFluidState( WellElementSubRegion & subRegion )
 {
   GEOSX_MARK_FUNCTION;
 
-  // the rank that owns the reference well element is responsible for the calculations below.
-  if( !subRegion.isLocallyOwned() )
-  {
-    return;
-  }
-
-  integer const numComp = m_numComponents;
-  localIndex const iwelemRef = subRegion.getTopWellElementIndex();
-
-  // subRegion data
-
-  arrayView1d< real64 const > const & pres =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::pressure >();
-  arrayView1d< real64 const > const & dPres =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::deltaPressure >();
-
-  arrayView1d< real64 > const & totalMassDens =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::totalMassDensity >();
-  arrayView1d< real64 > const & dTotalMassDens_dPres =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::dTotalMassDensity_dPressure >();
-  arrayView2d< real64, compflow::USD_FLUID_DC > const & dTotalMassDens_dCompDens =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::dTotalMassDensity_dGlobalCompDensity >();
-
-  arrayView1d< real64 const > const wellElemGravCoef =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::gravityCoefficient >();
-
-  // control data
-
-  WellControls & wellControls = getWellControls( subRegion );
-
-  real64 const & refGravCoef = wellControls.getReferenceGravityCoef();
-
-  real64 & currentBHP =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentBHPString() );
-  real64 & dCurrentBHP_dPres =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentBHP_dPresString() );
-  arrayView1d< real64 > const & dCurrentBHP_dCompDens =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentBHP_dCompDensString() );
-
-  // bring everything back to host, capture the scalars by reference
-  forAll< serialPolicy >( 1, [&numComp,
-                              pres,
-                              dPres,
-                              totalMassDens,
-                              dTotalMassDens_dPres,
-                              dTotalMassDens_dCompDens,
-                              wellElemGravCoef,
-                              &currentBHP,
-                              &dCurrentBHP_dPres,
-                              dCurrentBHP_dCompDens,
-                              &iwelemRef,
-                              &refGravCoef] ( localIndex const )
-  {
-    real64 const diffGravCoef = refGravCoef - wellElemGravCoef[iwelemRef];
-    currentBHP = pres[iwelemRef] + dPres[iwelemRef] + totalMassDens[iwelemRef] * diffGravCoef;
-    dCurrentBHP_dPres = 1 + dTotalMassDens_dPres[iwelemRef] * diffGravCoef;
-    for( integer ic = 0; ic < numComp; ++ic )
-    {
-      dCurrentBHP_dCompDens[ic] = dTotalMassDens_dCompDens[iwelemRef][ic] * diffGravCoef;
-    }
-  } );
-}
-
-void CompositionalMultiphaseWell::updateVolRatesForConstraint( WellElementSubRegion & subRegion )
-{
-  GEOSX_MARK_FUNCTION;
+  // update the component fractions, used at the conditions of the constraints and in the well elements
+  updateComponentFraction( subRegion );
 
   // the rank that owns the reference well element is responsible for the calculations below.
   if( !subRegion.isLocallyOwned() )
@@ -559,9 +495,6 @@ void CompositionalMultiphaseWell::updateVolRatesForConstraint( WellElementSubReg
     return;
   }
 
-  integer constexpr maxNumComp = constitutive::MultiFluidBase::MAX_NUM_COMPONENTS;
-  integer const numComp = m_numComponents;
-  integer const numPhase = m_numPhases;
   localIndex const iwelemRef = subRegion.getTopWellElementIndex();
 
   // subRegion data
@@ -574,96 +507,38 @@ void CompositionalMultiphaseWell::updateVolRatesForConstraint( WellElementSubReg
   arrayView1d< real64 const > const & temp =
     subRegion.getExtrinsicData< extrinsicMeshData::well::temperature >();
 
-  arrayView1d< real64 const > const & connRate =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::mixtureConnectionRate >();
-  arrayView1d< real64 const > const & dConnRate =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::deltaMixtureConnectionRate >();
-
   arrayView2d< real64 const, compflow::USD_COMP > const & compFrac =
     subRegion.getExtrinsicData< extrinsicMeshData::well::globalCompFraction >();
-  arrayView3d< real64 const, compflow::USD_COMP_DC > const & dCompFrac_dCompDens =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::dGlobalCompFraction_dGlobalCompDensity >();
 
   // fluid data
 
   string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
   MultiFluidBase & fluid = subRegion.getConstitutiveModel< MultiFluidBase >( fluidName );
 
-  arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseFrac = fluid.phaseFraction();
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseFrac = fluid.dPhaseFraction();
-
-  arrayView2d< real64 const, multifluid::USD_FLUID > const & totalDens = fluid.totalDensity();
-  arrayView3d< real64 const, multifluid::USD_FLUID_DC > const & dTotalDens = fluid.dTotalDensity();
-
-  arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseDens = fluid.phaseDensity();
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseDens = fluid.dPhaseDensity();
-
   // control data
 
-  WellControls & wellControls = getWellControls( subRegion );
+  WellControls const & wellControls = getWellControls( subRegion );
 
   integer const useSurfaceConditions = wellControls.useSurfaceConditions();
-  real64 const & surfacePres = wellControls.getSurfacePressure();
-  real64 const & surfaceTemp = wellControls.getSurfaceTemperature();
-
-  arrayView1d< real64 > const & currentPhaseVolRate =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::currentPhaseVolRateString() );
-  arrayView1d< real64 > const & dCurrentPhaseVolRate_dPres =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dPresString() );
-  arrayView2d< real64 > const & dCurrentPhaseVolRate_dCompDens =
-    wellControls.getReference< array2d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dCompDensString() );
-  arrayView1d< real64 > const & dCurrentPhaseVolRate_dRate =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dRateString() );
-
-  real64 & currentTotalVolRate =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentTotalVolRateString() );
-  real64 & dCurrentTotalVolRate_dPres =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dPresString() );
-  arrayView1d< real64 > const & dCurrentTotalVolRate_dCompDens =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dCompDensString() );
-  real64 & dCurrentTotalVolRate_dRate =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dRateString() );
+  real64 const surfacePres = wellControls.getSurfacePressure();
+  real64 const surfaceTemp = wellControls.getSurfaceTemperature();
 
   constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
-    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-
-    // bring everything back to host, capture the scalars by reference
-    forAll< serialPolicy >( 1, [&numComp,
-                                &numPhase,
-                                fluidWrapper,
-                                pres,
-                                dPres,
-                                temp,
-                                compFrac,
-                                dCompFrac_dCompDens,
-                                connRate,
-                                dConnRate,
-                                totalDens,
-                                dTotalDens,
-                                phaseDens,
-                                dPhaseDens,
-                                phaseFrac,
-                                dPhaseFrac,
-                                &useSurfaceConditions,
-                                &surfacePres,
-                                &surfaceTemp,
-                                &currentTotalVolRate,
-                                &dCurrentTotalVolRate_dPres,
-                                dCurrentTotalVolRate_dCompDens,
-                                &dCurrentTotalVolRate_dRate,
-                                currentPhaseVolRate,
-                                dCurrentPhaseVolRate_dPres,
-                                dCurrentPhaseVolRate_dCompDens,
-                                dCurrentPhaseVolRate_dRate,
-                                &iwelemRef] ( localIndex const )
-    {
-      using Deriv = multifluid::DerivativeOffset;
-
-      stackArray1d< real64, maxNumComp > work( numComp );
-
-      // Step 1: evaluate the phase and total density in the reference element
+    using FluidType = TYPEOFREF( castedFluid );
+    using ExecPolicy = typename FluidType::exec_policy;
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
+    forAll< ExecPolicy >( 1, [fluidWrapper,
+                              pres,
+                              dPres,
+                              temp,
+                              compFrac,
+                              useSurfaceConditions,
+                              surfacePres,
+                              surfaceTemp,
+                              iwelemRef] GEOSX_HOST_DEVICE ( localIndex const )
+    {
       //    We need to evaluate the density as follows:
       //      - Surface conditions: using the surface pressure provided by the user
       //      - Reservoir conditions: using the pressure in the top element
@@ -677,66 +552,207 @@ void CompositionalMultiphaseWell::updateVolRatesForConstraint( WellElementSubReg
         real64 const refPres = pres[iwelemRef] + dPres[iwelemRef];
         fluidWrapper.update( iwelemRef, 0, refPres, temp[iwelemRef], compFrac[iwelemRef] );
       }
+    } );
+  } );
+}
 
-      // Step 2: update the total volume rate
+void CompositionalMultiphaseWell::updateVolRatesForConstraints( ElementRegionManager const & elemManager,
+                                                                arrayView1d< string const > const & regionNames )
+{
+  GEOSX_MARK_FUNCTION;
+
+  integer const numComp = m_numComponents;
+  integer const numPhase = m_numPhases;
 
-      real64 const currentTotalRate = connRate[iwelemRef] + dConnRate[iwelemRef];
+  array1d< localIndex > refElemRegion;
+  array1d< localIndex > refElemSubRegion;
+  array1d< localIndex > refElemIndex;
+  std::vector< WellControls * > const wellControls =
+    getLocallyOwnedWells( elemManager, regionNames, refElemRegion, refElemSubRegion, refElemIndex );
+
+  localIndex const numWells = refElemIndex.size();
+  if( numWells == 0 )
+  {
+    return;
+  }
 
-      // Step 2.1: compute the inverse of the total density and derivatives
+  array1d< real64 > currentTotalVolRate( numWells );
+  array1d< real64 > dCurrentTotalVolRate_dPres( numWells );
+  array2d< real64 > dCurrentTotalVolRate_dCompDens( numWells, numComp );
+  array1d< real64 > dCurrentTotalVolRate_dRate( numWells );
 
-      real64 const totalDensInv = 1.0 / totalDens[iwelemRef][0];
-      real64 const dTotalDensInv_dPres = -dTotalDens[iwelemRef][0][Deriv::dP] * totalDensInv * totalDensInv;
-      stackArray1d< real64, maxNumComp > dTotalDensInv_dCompDens( numComp );
+  array2d< real64 > currentPhaseVolRate( numWells, numPhase );
+  array2d< real64 > dCurrentPhaseVolRate_dPres( numWells, numPhase );
+  array3d< real64 > dCurrentPhaseVolRate_dCompDens( numWells, numPhase, numComp );
+  array2d< real64 > dCurrentPhaseVolRate_dRate( numWells, numPhase );
+
+  // the phase rates are not updated for absent phases, so we start from the current values
+  array1d< integer > useSurfaceConditions( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls const & controls = *wellControls[iwell];
+    useSurfaceConditions[iwell] = controls.useSurfaceConditions();
+
+    arrayView1d< real64 const > const & phaseVolRate =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::currentPhaseVolRateString() );
+    arrayView1d< real64 const > const & dPhaseVolRate_dPres =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dPresString() );
+    arrayView2d< real64 const > const & dPhaseVolRate_dCompDens =
+      controls.getReference< array2d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dCompDensString() );
+    arrayView1d< real64 const > const & dPhaseVolRate_dRate =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dRateString() );
+
+    for( integer ip = 0; ip < numPhase; ++ip )
+    {
+      currentPhaseVolRate[iwell][ip] = phaseVolRate[ip];
+      dCurrentPhaseVolRate_dPres[iwell][ip] = dPhaseVolRate_dPres[ip];
+      dCurrentPhaseVolRate_dRate[iwell][ip] = dPhaseVolRate_dRate[ip];
       for( integer ic = 0; ic < numComp; ++ic )
       {
-        dTotalDensInv_dCompDens[ic] = -dTotalDens[iwelemRef][0][Deriv::dC+ic] * totalDensInv * totalDensInv;
+        dCurrentPhaseVolRate_dCompDens[iwell][ip][ic] = dPhaseVolRate_dCompDens[ip][ic];
       }
-      applyChainRuleInPlace( numComp, dCompFrac_dCompDens[iwelemRef], dTotalDensInv_dCompDens, work.data() );
+    }
+  }
 
-      // Step 2.2: divide the total mass/molar rate by the total density to get the total volumetric rate
-      currentTotalVolRate = currentTotalRate * totalDensInv;
-      dCurrentTotalVolRate_dPres = ( useSurfaceConditions ==  0 ) * currentTotalRate * dTotalDensInv_dPres;
-      dCurrentTotalVolRate_dRate = totalDensInv;
+  VolRateConstraintKernel::WellAccessors wellAccessors( elemManager, getName() );
+  VolRateConstraintKernel::WellFluidAccessors wellFluidAccessors( elemManager, getName() );
+
+  VolRateConstraintKernel::launch( numWells,
+                                   numComp,
+                                   numPhase,
+                                   refElemRegion.toViewConst(),
+                                   refElemSubRegion.toViewConst(),
+                                   refElemIndex.toViewConst(),
+                                   useSurfaceConditions.toViewConst(),
+                                   wellAccessors.get( extrinsicMeshData::well::mixtureConnectionRate{} ),
+                                   wellAccessors.get( extrinsicMeshData::well::deltaMixtureConnectionRate{} ),
+                                   wellAccessors.get( extrinsicMeshData::well::dGlobalCompFraction_dGlobalCompDensity{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::phaseFraction{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::dPhaseFraction{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::totalDensity{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::dTotalDensity{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::phaseDensity{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::multifluid::dPhaseDensity{} ),
+                                   currentTotalVolRate.toView(),
+                                   dCurrentTotalVolRate_dPres.toView(),
+                                   dCurrentTotalVolRate_dCompDens.toView(),
+                                   dCurrentTotalVolRate_dRate.toView(),
+                                   currentPhaseVolRate.toView(),
+                                   dCurrentPhaseVolRate_dPres.toView(),
+                                   dCurrentPhaseVolRate_dCompDens.toView(),
+                                   dCurrentPhaseVolRate_dRate.toView() );
+
+  // bring the rates back to host and store them in the controls of each well
+  currentTotalVolRate.move( LvArray::MemorySpace::host, false );
+  dCurrentTotalVolRate_dPres.move( LvArray::MemorySpace::host, false );
+  dCurrentTotalVolRate_dCompDens.move( LvArray::MemorySpace::host, false );
+  dCurrentTotalVolRate_dRate.move( LvArray::MemorySpace::host, false );
+  currentPhaseVolRate.move( LvArray::MemorySpace::host, false );
+  dCurrentPhaseVolRate_dPres.move( LvArray::MemorySpace::host, false );
+  dCurrentPhaseVolRate_dCompDens.move( LvArray::MemorySpace::host, false );
+  dCurrentPhaseVolRate_dRate.move( LvArray::MemorySpace::host, false );
+
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls & controls = *wellControls[iwell];
+
+    controls.getReference< real64 >( viewKeyStruct::currentTotalVolRateString() ) = currentTotalVolRate[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentTotalVolRate_dPresString() ) = dCurrentTotalVolRate_dPres[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentTotalVolRate_dRateString() ) = dCurrentTotalVolRate_dRate[iwell];
+
+    arrayView1d< real64 > const & dTotalVolRate_dCompDens =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentTotalVolRate_dCompDensString() );
+    arrayView1d< real64 > const & phaseVolRate =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::currentPhaseVolRateString() );
+    arrayView1d< real64 > const & dPhaseVolRate_dPres =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dPresString() );
+    arrayView2d< real64 > const & dPhaseVolRate_dCompDens =
+      controls.getReference< array2d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dCompDensString() );
+    arrayView1d< real64 > const & dPhaseVolRate_dRate =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentPhaseVolRate_dRateString() );
+
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      dTotalVolRate_dCompDens[ic] = dCurrentTotalVolRate_dCompDens[iwell][ic];
+    }
+    for( integer ip = 0; ip < numPhase; ++ip )
+    {
+      phaseVolRate[ip] = currentPhaseVolRate[iwell][ip];
+      dPhaseVolRate_dPres[ip] = dCurrentPhaseVolRate_dPres[iwell][ip];
+      dPhaseVolRate_dRate[ip] = dCurrentPhaseVolRate_dRate[iwell][ip];
       for( integer ic = 0; ic < numComp; ++ic )
       {
-        dCurrentTotalVolRate_dCompDens[ic] = currentTotalRate * dTotalDensInv_dCompDens[ic];
+        dPhaseVolRate_dCompDens[ip][ic] = dCurrentPhaseVolRate_dCompDens[iwell][ip][ic];
       }
+    }
+  }
+}
 
-      // Step 3: update the phase volume rate
-      for( integer ip = 0; ip < numPhase; ++ip )
-      {
+void CompositionalMultiphaseWell::updateBHPForConstraints( ElementRegionManager const & elemManager,
+                                                           arrayView1d< string const > const & regionNames )
+{
+  GEOSX_MARK_FUNCTION;
 
-        // Step 3.1: compute the inverse of the (phase density * phase fraction) and derivatives
+  integer const numComp = m_numComponents;
 
-        // skip the rest of this function if phase ip is absent
-        bool const phaseExists = (phaseFrac[iwelemRef][0][ip] > 0);
-        if( !phaseExists )
-        {
-          continue;
-        }
+  array1d< localIndex > refElemRegion;
+  array1d< localIndex > refElemSubRegion;
+  array1d< localIndex > refElemIndex;
+  std::vector< WellControls * > const wellControls =
+    getLocallyOwnedWells( elemManager, regionNames, refElemRegion, refElemSubRegion, refElemIndex );
 
-        real64 const phaseDensInv =  1.0 / phaseDens[iwelemRef][0][ip];
-        real64 const phaseFracTimesPhaseDensInv = phaseFrac[iwelemRef][0][ip] * phaseDensInv;
-        real64 const dPhaseFracTimesPhaseDensInv_dPres = dPhaseFrac[iwelemRef][0][ip][Deriv::dP] * phaseDensInv
-                                                         - dPhaseDens[iwelemRef][0][ip][Deriv::dP] * phaseFracTimesPhaseDensInv * phaseDensInv;
+  localIndex const numWells = refElemIndex.size();
+  if( numWells == 0 )
+  {
+    return;
+  }
 
+  array1d< real64 > refGravCoef( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    refGravCoef[iwell] = wellControls[iwell]->getReferenceGravityCoef();
+  }
 
-        // Step 3.2: divide the total mass/molar rate by the (phase density * phase fraction) to get the phase volumetric rate
-        currentPhaseVolRate[ip] = currentTotalRate * phaseFracTimesPhaseDensInv;
-        dCurrentPhaseVolRate_dPres[ip] = ( useSurfaceConditions ==  0 ) * currentTotalRate * dPhaseFracTimesPhaseDensInv_dPres;
-        dCurrentPhaseVolRate_dRate[ip] = phaseFracTimesPhaseDensInv;
-        for( integer ic = 0; ic < numComp; ++ic )
-        {
-          dCurrentPhaseVolRate_dCompDens[ip][ic] = -phaseFracTimesPhaseDensInv * dPhaseDens[iwelemRef][0][ip][Deriv::dC+ic] * phaseDensInv;
-          dCurrentPhaseVolRate_dCompDens[ip][ic] += dPhaseFrac[iwelemRef][0][ip][Deriv::dC+ic] * phaseDensInv;
-          dCurrentPhaseVolRate_dCompDens[ip][ic] *= currentTotalRate;
-        }
-        applyChainRuleInPlace( numComp, dCompFrac_dCompDens[iwelemRef], dCurrentPhaseVolRate_dCompDens[ip], work.data() );
-      }
-    } );
-  } );
-}
+  array1d< real64 > currentBHP( numWells );
+  array1d< real64 > dCurrentBHP_dPres( numWells );
+  array2d< real64 > dCurrentBHP_dCompDens( numWells, numComp );
+
+  BHPConstraintKernel::WellAccessors wellAccessors( elemManager, getName() );
+
+  BHPConstraintKernel::launch( numWells,
+                               numComp,
+                               refElemRegion.toViewConst(),
+                               refElemSubRegion.toViewConst(),
+                               refElemIndex.toViewConst(),
+                               refGravCoef.toViewConst(),
+                               wellAccessors.get( extrinsicMeshData::well::pressure{} ),
+                               wellAccessors.get( extrinsicMeshData::well::deltaPressure{} ),
+                               wellAccessors.get( extrinsicMeshData::well::gravityCoefficient{} ),
+                               wellAccessors.get( extrinsicMeshData::well::totalMassDensity{} ),
+                               wellAccessors.get( extrinsicMeshData::well::dTotalMassDensity_dPressure{} ),
+                               wellAccessors.get( extrinsicMeshData::well::dTotalMassDensity_dGlobalCompDensity{} ),
+                               currentBHP.toView(),
+                               dCurrentBHP_dPres.toView(),
+                               dCurrentBHP_dCompDens.toView() );
+
+  // bring the BHPs back to host and store them in the controls of each well
+  currentBHP.move( LvArray::MemorySpace::host, false );
+  dCurrentBHP_dPres.move( LvArray::MemorySpace::host, false );
+  dCurrentBHP_dCompDens.move( LvArray::MemorySpace::host, false );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls & controls = *wellControls[iwell];
+    controls.getReference< real64 >( viewKeyStruct::currentBHPString() ) = currentBHP[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentBHP_dPresString() ) = dCurrentBHP_dPres[iwell];
 
+    arrayView1d< real64 > const & dBHP_dCompDens =
+      controls.getReference< array1d< real64 > >( viewKeyStruct::dCurrentBHP_dCompDensString() );
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      dBHP_dCompDens[ic] = dCurrentBHP_dCompDens[iwell][ic];
+    }
+  }
+}
 
 void CompositionalMultiphaseWell::updateFluidModel( WellElementSubRegion & subRegion )
 {
@@ -796,24 +812,15 @@ void CompositionalMultiphaseWell::updateTotalMassDensity( WellElementSubRegion &
 
 }
 
-void CompositionalMultiphaseWell::updateSubRegionState( MeshLevel const & meshLevel,
-                                                        WellElementSubRegion & subRegion )
+void CompositionalMultiphaseWell::updateSubRegionFluidState( MeshLevel const & meshLevel,
+                                                             WellElementSubRegion & subRegion )
 {
-  // update properties
-  updateComponentFraction( subRegion );
-
-  // update volumetric rates for the well constraints
-  // note: this must be called before updateFluidModel
-  updateVolRatesForConstraint( subRegion );
-
   // update densities, phase fractions, phase volume fractions
+  // note: this must be called after updating the volumetric rates for the well constraints
   updateFluidModel( subRegion );
   updatePhaseVolumeFraction( subRegion );
   updateTotalMassDensity( subRegion );
 
-  // update the current BHP pressure
-  updateBHPForConstraint( subRegion );
-
   // update perforation rates
   computePerforationRates( meshLevel, subRegion );
 }
@@ -1634,6 +1641,9 @@ void CompositionalMultiphaseWell::assemblePressureRelations( DomainPartition con
 {
   GEOSX_MARK_FUNCTION;
 
+  // control switches are collected for all the wells and applied at once below
+  array1d< integer > controlHasSwitched( numSubGroups() );
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel const & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -1672,7 +1682,7 @@ void CompositionalMultiphaseWell::assemblePressureRelations( DomainPartition con
         subRegion.getExtrinsicData< extrinsicMeshData::well::dTotalMassDensity_dGlobalCompDensity >();
 
 
-      bool controlHasSwitched = false;
+      bool wellControlHasSwitched = false;
       compositionalMultiphaseBaseKernels::
         KernelLaunchSelector1< PressureRelationKernel >( numFluidComponents(),
                                                          subRegion.size(),
@@ -1692,41 +1702,44 @@ void CompositionalMultiphaseWell::assemblePressureRelations( DomainPartition con
                                                          wellElemTotalMassDens,
                                                          dWellElemTotalMassDens_dPres,
                                                          dWellElemTotalMassDens_dCompDens,
-                                                         controlHasSwitched,
+                                                         wellControlHasSwitched,
                                                          localMatrix,
                                                          localRhs );
 
-      if( controlHasSwitched )
-      {
-        // TODO: move the switch logic into wellControls
-        // TODO: implement a more general switch when more then two constraints per well type are allowed
-
-        real64 const timeAtEndOfStep = m_currentTime + m_currentDt;
-
-        if( wellControls.getControl() == WellControls::Control::BHP )
-        {
-          if( wellControls.isProducer() )
-          {
-            wellControls.switchToPhaseRateControl( wellControls.getTargetPhaseRate( timeAtEndOfStep ) );
-            GEOSX_LOG_LEVEL_RANK_0( 1, "Control switch for well " << subRegion.getName()
-                                                                  << " from BHP constraint to phase volumetric rate constraint" );
-          }
-          else
-          {
-            wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
-            GEOSX_LOG_LEVEL_RANK_0( 1, "Control switch for well " << subRegion.getName()
-                                                                  << " from BHP constraint to total volumetric rate constraint" );
-          }
-        }
-        else
-        {
-          wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
-          GEOSX_LOG_LEVEL_RANK_0( 1, "Control switch for well " << subRegion.getName()
-                                                                << " from rate constraint to BHP constraint" );
-        }
-      }
+      controlHasSwitched[getWellControlsIndex( subRegion )] = wellControlHasSwitched;
     } );
   } );
+
+  applyWellControlSwitches( controlHasSwitched.toViewConst() );
+}
+
+void CompositionalMultiphaseWell::switchWellControl( WellControls & wellControls,
+                                                     real64 const & timeAtEndOfStep,
+                                                     bool const logSwitch ) const
+{
+  // TODO: implement a more general switch when more then two constraints per well type are allowed
+
+  if( wellControls.getControl() == WellControls::Control::BHP )
+  {
+    if( wellControls.isProducer() )
+    {
+      wellControls.switchToPhaseRateControl( wellControls.getTargetPhaseRate( timeAtEndOfStep ) );
+      GEOSX_LOG_RANK_IF( logSwitch && getLogLevel() >= 1, "Control switch for well " << wellControls.getName()
+                                                                                     << " from BHP constraint to phase volumetric rate constraint" );
+    }
+    else
+    {
+      wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
+      GEOSX_LOG_RANK_IF( logSwitch && getLogLevel() >= 1, "Control switch for well " << wellControls.getName()
+                                                                                     << " from BHP constraint to total volumetric rate constraint" );
+    }
+  }
+  else
+  {
+    wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
+    GEOSX_LOG_RANK_IF( logSwitch && getLogLevel() >= 1, "Control switch for well " << wellControls.getName()
+                                                                                   << " from rate constraint to BHP constraint" );
+  }
 }
 
 void CompositionalMultiphaseWell::implicitStepSetup( real64 const & time_n,
@@ -132,18 +132,26 @@ public:
   void updateComponentFraction( WellElementSubRegion & subRegion ) const;
 
   /**
-   * @brief Recompute the volumetric rates that are used in the well constraints
+   * @brief Recompute the component fractions, and evaluate the fluid in the reference element at the conditions of the rate constraints
    * @param subRegion the well subregion containing all the primary and dependent fields
-   * @param targetIndex the targetIndex of the subRegion
    */
-  void updateVolRatesForConstraint( WellElementSubRegion & subRegion );
+  virtual void updateReferenceFluidState( WellElementSubRegion & subRegion ) override;
 
   /**
-   * @brief Recompute the current BHP pressure
-   * @param subRegion the well subregion containing all the primary and dependent fields
-   * @param targetIndex the targetIndex of the subRegion
+   * @brief Recompute the volumetric rates that are used in the constraints of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
+   */
+  virtual void updateVolRatesForConstraints( ElementRegionManager const & elemManager,
+                                             arrayView1d< string const > const & regionNames ) override;
+
+  /**
+   * @brief Recompute the current BHP pressure of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
    */
-  void updateBHPForConstraint( WellElementSubRegion & subRegion );
+  virtual void updateBHPForConstraints( ElementRegionManager const & elemManager,
+                                        arrayView1d< string const > const & regionNames ) override;
 
   /**
    * @brief Update all relevant fluid models using current values of pressure and composition
@@ -167,13 +175,12 @@ public:
 
 
   /**
-   * @brief Recompute all dependent quantities from primary variables (including constitutive models)
+   * @brief Recompute the fluid properties and the perforation rates from primary variables
    * @param meshLevel the mesh level
    * @param subRegion the well subregion containing all the primary and dependent fields
-   * @param targetIndex the targetIndex of the subRegion
    */
-  virtual void updateSubRegionState( MeshLevel const & meshLevel,
-                                     WellElementSubRegion & subRegion ) override;
+  virtual void updateSubRegionFluidState( MeshLevel const & meshLevel,
+                                          WellElementSubRegion & subRegion ) override;
 
   virtual string wellElementDofName() const override { return viewKeyStruct::dofFieldString(); }
 
@@ -235,6 +242,16 @@ public:
                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                           arrayView1d< real64 > const & localRhs ) override;
 
+  /**
+   * @brief Switch the control of a well whose current constraint is no longer viable
+   * @param wellControls the controls of the well
+   * @param timeAtEndOfStep the time at which the new target is evaluated
+   * @param logSwitch flag to report the switch, only set on the rank that detected it
+   */
+  virtual void switchWellControl( WellControls & wellControls,
+                                  real64 const & timeAtEndOfStep,
+                                  bool const logSwitch ) const override;
+
 
   /**
    * @brief Sets all the negative component densities (if any) to zero.
@@ -1748,6 +1748,140 @@ RateInitializationKernel::
   } );
 }
 
+/******************************** VolRateConstraintKernel ********************************/
+
+void
+VolRateConstraintKernel::
+  launch( localIndex const numWells,
+          integer const numComp,
+          integer const numPhase,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< integer const > const & useSurfaceConditions,
+          ElementViewConst< arrayView1d< real64 const > > const & connRate,
+          ElementViewConst< arrayView1d< real64 const > > const & dConnRate,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseFrac,
+          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseFrac,
+          ElementViewConst< arrayView2d< real64 const, multifluid::USD_FLUID > > const & totalDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_FLUID_DC > > const & dTotalDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
+          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
+          arrayView1d< real64 > const & currentTotalVolRate,
+          arrayView1d< real64 > const & dCurrentTotalVolRate_dPres,
+          arrayView2d< real64 > const & dCurrentTotalVolRate_dCompDens,
+          arrayView1d< real64 > const & dCurrentTotalVolRate_dRate,
+          arrayView2d< real64 > const & currentPhaseVolRate,
+          arrayView2d< real64 > const & dCurrentPhaseVolRate_dPres,
+          arrayView3d< real64 > const & dCurrentPhaseVolRate_dCompDens,
+          arrayView2d< real64 > const & dCurrentPhaseVolRate_dRate )
+{
+  integer constexpr maxNumComp = constitutive::MultiFluidBase::MAX_NUM_COMPONENTS;
+
+  forAll< parallelDevicePolicy<> >( numWells, [=] GEOSX_HOST_DEVICE ( localIndex const iwell )
+  {
+    using Deriv = multifluid::DerivativeOffset;
+
+    localIndex const er = refElemRegion[iwell];
+    localIndex const esr = refElemSubRegion[iwell];
+    localIndex const iwelemRef = refElemIndex[iwell];
+    integer const useSurfaceCond = useSurfaceConditions[iwell];
+
+    stackArray1d< real64, maxNumComp > work( numComp );
+
+    // Step 1: update the total volume rate
+
+    real64 const currentTotalRate = connRate[er][esr][iwelemRef] + dConnRate[er][esr][iwelemRef];
+
+    // Step 1.1: compute the inverse of the total density and derivatives
+
+    real64 const totalDensInv = 1.0 / totalDens[er][esr][iwelemRef][0];
+    real64 const dTotalDensInv_dPres = -dTotalDens[er][esr][iwelemRef][0][Deriv::dP] * totalDensInv * totalDensInv;
+    stackArray1d< real64, maxNumComp > dTotalDensInv_dCompDens( numComp );
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      dTotalDensInv_dCompDens[ic] = -dTotalDens[er][esr][iwelemRef][0][Deriv::dC+ic] * totalDensInv * totalDensInv;
+    }
+    applyChainRuleInPlace( numComp, dCompFrac_dCompDens[er][esr][iwelemRef], dTotalDensInv_dCompDens, work.data() );
+
+    // Step 1.2: divide the total mass/molar rate by the total density to get the total volumetric rate
+    currentTotalVolRate[iwell] = currentTotalRate * totalDensInv;
+    dCurrentTotalVolRate_dPres[iwell] = ( useSurfaceCond ==  0 ) * currentTotalRate * dTotalDensInv_dPres;
+    dCurrentTotalVolRate_dRate[iwell] = totalDensInv;
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      dCurrentTotalVolRate_dCompDens[iwell][ic] = currentTotalRate * dTotalDensInv_dCompDens[ic];
+    }
+
+    // Step 2: update the phase volume rate
+    for( integer ip = 0; ip < numPhase; ++ip )
+    {
+
+      // Step 2.1: compute the inverse of the (phase density * phase fraction) and derivatives
+
+      // skip the rest of this loop if phase ip is absent
+      bool const phaseExists = (phaseFrac[er][esr][iwelemRef][0][ip] > 0);
+      if( !phaseExists )
+      {
+        continue;
+      }
+
+      real64 const phaseDensInv =  1.0 / phaseDens[er][esr][iwelemRef][0][ip];
+      real64 const phaseFracTimesPhaseDensInv = phaseFrac[er][esr][iwelemRef][0][ip] * phaseDensInv;
+      real64 const dPhaseFracTimesPhaseDensInv_dPres = dPhaseFrac[er][esr][iwelemRef][0][ip][Deriv::dP] * phaseDensInv
+                                                       - dPhaseDens[er][esr][iwelemRef][0][ip][Deriv::dP] * phaseFracTimesPhaseDensInv * phaseDensInv;
+
+      // Step 2.2: divide the total mass/molar rate by the (phase density * phase fraction) to get the phase volumetric rate
+      currentPhaseVolRate[iwell][ip] = currentTotalRate * phaseFracTimesPhaseDensInv;
+      dCurrentPhaseVolRate_dPres[iwell][ip] = ( useSurfaceCond ==  0 ) * currentTotalRate * dPhaseFracTimesPhaseDensInv_dPres;
+      dCurrentPhaseVolRate_dRate[iwell][ip] = phaseFracTimesPhaseDensInv;
+      for( integer ic = 0; ic < numComp; ++ic )
+      {
+        dCurrentPhaseVolRate_dCompDens[iwell][ip][ic] = -phaseFracTimesPhaseDensInv * dPhaseDens[er][esr][iwelemRef][0][ip][Deriv::dC+ic] * phaseDensInv;
+        dCurrentPhaseVolRate_dCompDens[iwell][ip][ic] += dPhaseFrac[er][esr][iwelemRef][0][ip][Deriv::dC+ic] * phaseDensInv;
+        dCurrentPhaseVolRate_dCompDens[iwell][ip][ic] *= currentTotalRate;
+      }
+      applyChainRuleInPlace( numComp, dCompFrac_dCompDens[er][esr][iwelemRef], dCurrentPhaseVolRate_dCompDens[iwell][ip], work.data() );
+    }
+  } );
+}
+
+/******************************** BHPConstraintKernel ********************************/
+
+void
+BHPConstraintKernel::
+  launch( localIndex const numWells,
+          integer const numComp,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< real64 const > const & refGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & totalMassDens,
+          ElementViewConst< arrayView1d< real64 const > > const & dTotalMassDens_dPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dTotalMassDens_dCompDens,
+          arrayView1d< real64 > const & currentBHP,
+          arrayView1d< real64 > const & dCurrentBHP_dPres,
+          arrayView2d< real64 > const & dCurrentBHP_dCompDens )
+{
+  forAll< parallelDevicePolicy<> >( numWells, [=] GEOSX_HOST_DEVICE ( localIndex const iwell )
+  {
+    localIndex const er = refElemRegion[iwell];
+    localIndex const esr = refElemSubRegion[iwell];
+    localIndex const iwelemRef = refElemIndex[iwell];
+
+    real64 const diffGravCoef = refGravCoef[iwell] - wellElemGravCoef[er][esr][iwelemRef];
+    currentBHP[iwell] = pres[er][esr][iwelemRef] + dPres[er][esr][iwelemRef] + totalMassDens[er][esr][iwelemRef] * diffGravCoef;
+    dCurrentBHP_dPres[iwell] = 1 + dTotalMassDens_dPres[er][esr][iwelemRef] * diffGravCoef;
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      dCurrentBHP_dCompDens[iwell][ic] = dTotalMassDens_dCompDens[er][esr][iwelemRef][ic] * diffGravCoef;
+    }
+  } );
+}
 
 } // end namespace compositionalMultiphaseWellKernels
 
@@ -33,6 +33,7 @@
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
 #include "physicsSolvers/fluidFlow/wells/CompositionalMultiphaseWellExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellSolverBaseExtrinsicData.hpp"
 
 namespace geosx
 {
@@ -499,6 +500,136 @@ struct RateInitializationKernel
 
 };
 
+/******************************** VolRateConstraintKernel ********************************/
+
+struct VolRateConstraintKernel
+{
+
+  using WellAccessors =
+    StencilAccessors< extrinsicMeshData::well::mixtureConnectionRate,
+                      extrinsicMeshData::well::deltaMixtureConnectionRate,
+                      extrinsicMeshData::well::dGlobalCompFraction_dGlobalCompDensity >;
+
+  using WellFluidAccessors =
+    StencilMaterialAccessors< MultiFluidBase,
+                              extrinsicMeshData::multifluid::phaseFraction,
+                              extrinsicMeshData::multifluid::dPhaseFraction,
+                              extrinsicMeshData::multifluid::totalDensity,
+                              extrinsicMeshData::multifluid::dTotalDensity,
+                              extrinsicMeshData::multifluid::phaseDensity,
+                              extrinsicMeshData::multifluid::dPhaseDensity >;
+
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  /**
+   * @brief Compute the total and phase volumetric rates of all the wells owned by this rank in a single launch
+   * @param[in] numWells the number of wells owned by this rank
+   * @param[in] numComp the number of fluid components
+   * @param[in] numPhase the number of fluid phases
+   * @param[in] refElemRegion the region index of the reference element of each well
+   * @param[in] refElemSubRegion the subregion index of the reference element of each well
+   * @param[in] refElemIndex the index of the reference element of each well
+   * @param[in] useSurfaceConditions for each well, 1 if the rates are evaluated at surface conditions
+   * @param[in] connRate the mixture connection rates
+   * @param[in] dConnRate the increment of the mixture connection rates
+   * @param[in] dCompFrac_dCompDens the derivatives of the global component fractions wrt component densities
+   * @param[in] phaseFrac the phase fractions, evaluated at the conditions of the constraint in the reference element
+   * @param[in] dPhaseFrac the derivatives of the phase fractions
+   * @param[in] totalDens the total density, evaluated at the conditions of the constraint in the reference element
+   * @param[in] dTotalDens the derivatives of the total density
+   * @param[in] phaseDens the phase densities, evaluated at the conditions of the constraint in the reference element
+   * @param[in] dPhaseDens the derivatives of the phase densities
+   * @param[out] currentTotalVolRate the total volumetric rate of each well
+   * @param[out] dCurrentTotalVolRate_dPres the derivative of the total volumetric rate wrt pressure
+   * @param[out] dCurrentTotalVolRate_dCompDens the derivatives of the total volumetric rate wrt component densities
+   * @param[out] dCurrentTotalVolRate_dRate the derivative of the total volumetric rate wrt connection rate
+   * @param[inout] currentPhaseVolRate the phase volumetric rates of each well, left unchanged for absent phases
+   * @param[inout] dCurrentPhaseVolRate_dPres the derivatives of the phase volumetric rates wrt pressure
+   * @param[inout] dCurrentPhaseVolRate_dCompDens the derivatives of the phase volumetric rates wrt component densities
+   * @param[inout] dCurrentPhaseVolRate_dRate the derivatives of the phase volumetric rates wrt connection rate
+   */
+  static void
+  launch( localIndex const numWells,
+          integer const numComp,
+          integer const numPhase,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< integer const > const & useSurfaceConditions,
+          ElementViewConst< arrayView1d< real64 const > > const & connRate,
+          ElementViewConst< arrayView1d< real64 const > > const & dConnRate,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseFrac,
+          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseFrac,
+          ElementViewConst< arrayView2d< real64 const, multifluid::USD_FLUID > > const & totalDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_FLUID_DC > > const & dTotalDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
+          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
+          arrayView1d< real64 > const & currentTotalVolRate,
+          arrayView1d< real64 > const & dCurrentTotalVolRate_dPres,
+          arrayView2d< real64 > const & dCurrentTotalVolRate_dCompDens,
+          arrayView1d< real64 > const & dCurrentTotalVolRate_dRate,
+          arrayView2d< real64 > const & currentPhaseVolRate,
+          arrayView2d< real64 > const & dCurrentPhaseVolRate_dPres,
+          arrayView3d< real64 > const & dCurrentPhaseVolRate_dCompDens,
+          arrayView2d< real64 > const & dCurrentPhaseVolRate_dRate );
+
+};
+
+/******************************** BHPConstraintKernel ********************************/
+
+struct BHPConstraintKernel
+{
+
+  using WellAccessors =
+    StencilAccessors< extrinsicMeshData::well::pressure,
+                      extrinsicMeshData::well::deltaPressure,
+                      extrinsicMeshData::well::gravityCoefficient,
+                      extrinsicMeshData::well::totalMassDensity,
+                      extrinsicMeshData::well::dTotalMassDensity_dPressure,
+                      extrinsicMeshData::well::dTotalMassDensity_dGlobalCompDensity >;
+
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  /**
+   * @brief Compute the bottom-hole pressure of all the wells owned by this rank in a single launch
+   * @param[in] numWells the number of wells owned by this rank
+   * @param[in] numComp the number of fluid components
+   * @param[in] refElemRegion the region index of the reference element of each well
+   * @param[in] refElemSubRegion the subregion index of the reference element of each well
+   * @param[in] refElemIndex the index of the reference element of each well
+   * @param[in] refGravCoef the gravity coefficient at the reference elevation of each well
+   * @param[in] pres the well element pressure
+   * @param[in] dPres the increment of the well element pressure
+   * @param[in] wellElemGravCoef the gravity coefficient of the well elements
+   * @param[in] totalMassDens the total mass density of the well elements
+   * @param[in] dTotalMassDens_dPres the derivative of the total mass density wrt pressure
+   * @param[in] dTotalMassDens_dCompDens the derivatives of the total mass density wrt component densities
+   * @param[out] currentBHP the bottom-hole pressure of each well
+   * @param[out] dCurrentBHP_dPres the derivative of the bottom-hole pressure wrt pressure
+   * @param[out] dCurrentBHP_dCompDens the derivatives of the bottom-hole pressure wrt component densities
+   */
+  static void
+  launch( localIndex const numWells,
+          integer const numComp,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< real64 const > const & refGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & totalMassDens,
+          ElementViewConst< arrayView1d< real64 const > > const & dTotalMassDens_dPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dTotalMassDens_dCompDens,
+          arrayView1d< real64 > const & currentBHP,
+          arrayView1d< real64 > const & dCurrentBHP_dPres,
+          arrayView2d< real64 > const & dCurrentBHP_dCompDens );
+
+};
+
 
 /******************************** TotalMassDensityKernel ****************************/
 
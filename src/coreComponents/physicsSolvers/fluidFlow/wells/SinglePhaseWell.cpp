@@ -142,7 +142,7 @@ void SinglePhaseWell::validateWellConstraints( WellElementSubRegion const & subR
                   InputError );
 }
 
-void SinglePhaseWell::updateBHPForConstraint( WellElementSubRegion & subRegion )
+void SinglePhaseWell::updateReferenceFluidState( WellElementSubRegion & subRegion )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -161,128 +161,145 @@ void SinglePhaseWell::updateBHPForConstraint( WellElementSubRegion & subRegion )
   arrayView1d< real64 const > const dPres =
     subRegion.getExtrinsicData< extrinsicMeshData::well::deltaPressure >();
 
-  arrayView1d< real64 const > const wellElemGravCoef =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::gravityCoefficient >();
-
   // fluid data
+
   string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
   SingleFluidBase & fluid = subRegion.getConstitutiveModel< SingleFluidBase >( fluidName );
-  arrayView2d< real64 const > const & dens = fluid.density();
-  arrayView2d< real64 const > const & dDens_dPres = fluid.dDensity_dPressure();
 
   // control data
 
-  WellControls & wellControls = getWellControls( subRegion );
-
-  real64 const & refGravCoef = wellControls.getReferenceGravityCoef();
-
-  real64 & currentBHP =
-    wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::currentBHPString() );
-  real64 & dCurrentBHP_dPres =
-    wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::dCurrentBHP_dPresString() );
-
-  // bring everything back to host, capture the scalars by reference
-  forAll< serialPolicy >( 1, [pres,
-                              dPres,
-                              dens,
-                              dDens_dPres,
-                              wellElemGravCoef,
-                              &currentBHP,
-                              &dCurrentBHP_dPres,
-                              &iwelemRef,
-                              &refGravCoef] ( localIndex const )
+  WellControls const & wellControls = getWellControls( subRegion );
+
+  integer const useSurfaceConditions = wellControls.useSurfaceConditions();
+  real64 const surfacePres = wellControls.getSurfacePressure();
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
   {
-    currentBHP = pres[iwelemRef] + dPres[iwelemRef] + dens[iwelemRef][0] * ( refGravCoef - wellElemGravCoef[iwelemRef] );
-    dCurrentBHP_dPres = 1.0 + dDens_dPres[iwelemRef][0] * ( refGravCoef - wellElemGravCoef[iwelemRef] );
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    forAll< parallelDevicePolicy<> >( 1, [fluidWrapper,
+                                          pres,
+                                          dPres,
+                                          useSurfaceConditions,
+                                          surfacePres,
+                                          iwelemRef] GEOSX_HOST_DEVICE ( localIndex const )
+    {
+      //    We need to evaluate the density as follows:
+      //      - Surface conditions: using the surface pressure provided by the user
+      //      - Reservoir conditions: using the pressure in the top element
+      real64 const refPres = useSurfaceConditions ? surfacePres : pres[iwelemRef] + dPres[iwelemRef];
+      fluidWrapper.update( iwelemRef, 0, refPres );
+    } );
   } );
 }
 
-void SinglePhaseWell::updateVolRateForConstraint( WellElementSubRegion & subRegion )
+void SinglePhaseWell::updateVolRatesForConstraints( ElementRegionManager const & elemManager,
+                                                    arrayView1d< string const > const & regionNames )
 {
   GEOSX_MARK_FUNCTION;
 
-  // the rank that owns the reference well element is responsible for the calculations below.
-  if( !subRegion.isLocallyOwned() )
+  array1d< localIndex > refElemRegion;
+  array1d< localIndex > refElemSubRegion;
+  array1d< localIndex > refElemIndex;
+  std::vector< WellControls * > const wellControls =
+    getLocallyOwnedWells( elemManager, regionNames, refElemRegion, refElemSubRegion, refElemIndex );
+
+  localIndex const numWells = refElemIndex.size();
+  if( numWells == 0 )
   {
     return;
   }
 
-  localIndex const iwelemRef = subRegion.getTopWellElementIndex();
-
-  // subRegion data
-
-  arrayView1d< real64 const > const pres =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::pressure >();
-  arrayView1d< real64 const > const dPres =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::deltaPressure >();
-
-  arrayView1d< real64 const > const & connRate =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::connectionRate >();
-  arrayView1d< real64 const > const & dConnRate =
-    subRegion.getExtrinsicData< extrinsicMeshData::well::deltaConnectionRate >();
-
-  // fluid data
-
-  string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
-  SingleFluidBase & fluid = subRegion.getConstitutiveModel< SingleFluidBase >( fluidName );
-  arrayView2d< real64 const > const & dens = fluid.density();
-  arrayView2d< real64 const > const & dDens_dPres = fluid.dDensity_dPressure();
-
-  // control data
+  array1d< integer > useSurfaceConditions( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    useSurfaceConditions[iwell] = wellControls[iwell]->useSurfaceConditions();
+  }
 
-  WellControls & wellControls = getWellControls( subRegion );
+  array1d< real64 > currentVolRate( numWells );
+  array1d< real64 > dCurrentVolRate_dPres( numWells );
+  array1d< real64 > dCurrentVolRate_dRate( numWells );
+
+  VolRateConstraintKernel::WellAccessors wellAccessors( elemManager, getName() );
+  VolRateConstraintKernel::WellFluidAccessors wellFluidAccessors( elemManager, getName() );
+
+  VolRateConstraintKernel::launch( numWells,
+                                   refElemRegion.toViewConst(),
+                                   refElemSubRegion.toViewConst(),
+                                   refElemIndex.toViewConst(),
+                                   useSurfaceConditions.toViewConst(),
+                                   wellAccessors.get( extrinsicMeshData::well::connectionRate{} ),
+                                   wellAccessors.get( extrinsicMeshData::well::deltaConnectionRate{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::singlefluid::density{} ),
+                                   wellFluidAccessors.get( extrinsicMeshData::singlefluid::dDensity_dPressure{} ),
+                                   currentVolRate.toView(),
+                                   dCurrentVolRate_dPres.toView(),
+                                   dCurrentVolRate_dRate.toView() );
+
+  // bring the rates back to host and store them in the controls of each well
+  currentVolRate.move( LvArray::MemorySpace::host, false );
+  dCurrentVolRate_dPres.move( LvArray::MemorySpace::host, false );
+  dCurrentVolRate_dRate.move( LvArray::MemorySpace::host, false );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls & controls = *wellControls[iwell];
+    controls.getReference< real64 >( viewKeyStruct::currentVolRateString() ) = currentVolRate[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentVolRate_dPresString() ) = dCurrentVolRate_dPres[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentVolRate_dRateString() ) = dCurrentVolRate_dRate[iwell];
+  }
+}
 
-  integer const useSurfaceConditions = wellControls.useSurfaceConditions();
-  real64 const & surfacePres = wellControls.getSurfacePressure();
+void SinglePhaseWell::updateBHPForConstraints( ElementRegionManager const & elemManager,
+                                               arrayView1d< string const > const & regionNames )
+{
+  GEOSX_MARK_FUNCTION;
 
-  real64 & currentVolRate =
-    wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::currentVolRateString() );
-  real64 & dCurrentVolRate_dPres =
-    wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::dCurrentVolRate_dPresString() );
-  real64 & dCurrentVolRate_dRate =
-    wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::dCurrentVolRate_dRateString() );
+  array1d< localIndex > refElemRegion;
+  array1d< localIndex > refElemSubRegion;
+  array1d< localIndex > refElemIndex;
+  std::vector< WellControls * > const wellControls =
+    getLocallyOwnedWells( elemManager, regionNames, refElemRegion, refElemSubRegion, refElemIndex );
 
-  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  localIndex const numWells = refElemIndex.size();
+  if( numWells == 0 )
   {
-    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-
-    // bring everything back to host, capture the scalars by reference
-    forAll< serialPolicy >( 1, [fluidWrapper,
-                                pres,
-                                dPres,
-                                connRate,
-                                dConnRate,
-                                dens,
-                                dDens_dPres,
-                                &useSurfaceConditions,
-                                &surfacePres,
-                                &currentVolRate,
-                                &dCurrentVolRate_dPres,
-                                &dCurrentVolRate_dRate,
-                                &iwelemRef] ( localIndex const )
-    {
-      //    We need to evaluate the density as follows:
-      //      - Surface conditions: using the surface pressure provided by the user
-      //      - Reservoir conditions: using the pressure in the top element
-
-      if( useSurfaceConditions )
-      {
-        // we need to compute the surface density
-        fluidWrapper.update( iwelemRef, 0, surfacePres );
-      }
-      else
-      {
-        real64 const refPres = pres[iwelemRef] + dPres[iwelemRef];
-        fluidWrapper.update( iwelemRef, 0, refPres );
-      }
+    return;
+  }
 
-      real64 const densInv = 1.0 / dens[iwelemRef][0];
-      currentVolRate = ( connRate[iwelemRef] + dConnRate[iwelemRef] ) * densInv;
-      dCurrentVolRate_dPres = -( useSurfaceConditions ==  0 ) * dDens_dPres[iwelemRef][0] * currentVolRate * densInv;
-      dCurrentVolRate_dRate = densInv;
+  array1d< real64 > refGravCoef( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    refGravCoef[iwell] = wellControls[iwell]->getReferenceGravityCoef();
+  }
 
-    } );
-  } );
+  array1d< real64 > currentBHP( numWells );
+  array1d< real64 > dCurrentBHP_dPres( numWells );
+
+  BHPConstraintKernel::WellAccessors wellAccessors( elemManager, getName() );
+  BHPConstraintKernel::WellFluidAccessors wellFluidAccessors( elemManager, getName() );
+
+  BHPConstraintKernel::launch( numWells,
+                               refElemRegion.toViewConst(),
+                               refElemSubRegion.toViewConst(),
+                               refElemIndex.toViewConst(),
+                               refGravCoef.toViewConst(),
+                               wellAccessors.get( extrinsicMeshData::well::pressure{} ),
+                               wellAccessors.get( extrinsicMeshData::well::deltaPressure{} ),
+                               wellAccessors.get( extrinsicMeshData::well::gravityCoefficient{} ),
+                               wellFluidAccessors.get( extrinsicMeshData::singlefluid::density{} ),
+                               wellFluidAccessors.get( extrinsicMeshData::singlefluid::dDensity_dPressure{} ),
+                               currentBHP.toView(),
+                               dCurrentBHP_dPres.toView() );
+
+  // bring the BHPs back to host and store them in the controls of each well
+  currentBHP.move( LvArray::MemorySpace::host, false );
+  dCurrentBHP_dPres.move( LvArray::MemorySpace::host, false );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls & controls = *wellControls[iwell];
+    controls.getReference< real64 >( viewKeyStruct::currentBHPString() ) = currentBHP[iwell];
+    controls.getReference< real64 >( viewKeyStruct::dCurrentBHP_dPresString() ) = dCurrentBHP_dPres[iwell];
+  }
 }
 
 void SinglePhaseWell::updateFluidModel( WellElementSubRegion & subRegion ) const
@@ -302,18 +319,12 @@ void SinglePhaseWell::updateFluidModel( WellElementSubRegion & subRegion ) const
   } );
 }
 
-void SinglePhaseWell::updateSubRegionState( MeshLevel const & meshLevel, WellElementSubRegion & subRegion )
+void SinglePhaseWell::updateSubRegionFluidState( MeshLevel const & meshLevel, WellElementSubRegion & subRegion )
 {
-  // update volumetric rates for the well constraints
-  // Warning! This must be called before updating the fluid model
-  updateVolRateForConstraint( subRegion );
-
   // update density in the well elements
+  // Warning! This must be called after updating the volumetric rates for the well constraints
   updateFluidModel( subRegion );
 
-  // update the current BHP
-  updateBHPForConstraint( subRegion );
-
   // update perforation rates
   computePerforationRates( meshLevel, subRegion );
 }
@@ -451,6 +462,9 @@ void SinglePhaseWell::assemblePressureRelations( DomainPartition const & domain,
 {
   GEOSX_MARK_FUNCTION;
 
+  // control switches are collected for all the wells and applied at once below
+  array1d< integer > controlHasSwitched( numSubGroups() );
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel const & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -487,7 +501,7 @@ void SinglePhaseWell::assemblePressureRelations( DomainPartition const & domain,
       arrayView2d< real64 const > const & wellElemDensity = fluid.density();
       arrayView2d< real64 const > const & dWellElemDensity_dPres = fluid.dDensity_dPressure();
 
-      localIndex const controlHasSwitched =
+      localIndex const wellControlHasSwitched =
         PressureRelationKernel::launch( subRegion.size(),
                                         dofManager.rankOffset(),
                                         subRegion.isLocallyOwned(),
@@ -504,29 +518,32 @@ void SinglePhaseWell::assemblePressureRelations( DomainPartition const & domain,
                                         localMatrix,
                                         localRhs );
 
-      if( controlHasSwitched == 1 )
-      {
-        // Note: if BHP control is not viable, we switch to TOTALVOLRATE
-        //       if TOTALVOLRATE is not viable, we switch to BHP
-
-        real64 const timeAtEndOfStep = m_currentTime + m_currentDt;
-
-        if( wellControls.getControl() == WellControls::Control::BHP )
-        {
-          wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
-          GEOSX_LOG_LEVEL_RANK_0( 1, "Control switch for well " << subRegion.getName()
-                                                                << " from BHP constraint to rate constraint" );
-        }
-        else
-        {
-          wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
-          GEOSX_LOG_LEVEL_RANK_0( 1, "Control switch for well " << subRegion.getName()
-                                                                << " from rate constraint to BHP constraint" );
-        }
-      }
-
+      controlHasSwitched[getWellControlsIndex( subRegion )] = ( wellControlHasSwitched == 1 );
     } );
   } );
+
+  applyWellControlSwitches( controlHasSwitched.toViewConst() );
+}
+
+void SinglePhaseWell::switchWellControl( WellControls & wellControls,
+                                         real64 const & timeAtEndOfStep,
+                                         bool const logSwitch ) const
+{
+  // Note: if BHP control is not viable, we switch to TOTALVOLRATE
+  //       if TOTALVOLRATE is not viable, we switch to BHP
+
+  if( wellControls.getControl() == WellControls::Control::BHP )
+  {
+    wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
+    GEOSX_LOG_RANK_IF( logSwitch && getLogLevel() >= 1, "Control switch for well " << wellControls.getName()
+                                                                                   << " from BHP constraint to rate constraint" );
+  }
+  else
+  {
+    wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
+    GEOSX_LOG_RANK_IF( logSwitch && getLogLevel() >= 1, "Control switch for well " << wellControls.getName()
+                                                                                   << " from rate constraint to BHP constraint" );
+  }
 }
 
 void SinglePhaseWell::assembleAccumulationTerms( DomainPartition const & domain,
@@ -131,18 +131,26 @@ public:
   virtual localIndex numFluidPhases() const override { return 1; }
 
   /**
-   * @brief Recompute the volumetric rate that are used in the well constraints
+   * @brief Evaluate the density in the reference element at the pressure of the rate constraint
    * @param subRegion the well subregion containing all the primary and dependent fields
-   * @param targetIndex the targetIndex of the subRegion
    */
-  virtual void updateVolRateForConstraint( WellElementSubRegion & subRegion );
+  virtual void updateReferenceFluidState( WellElementSubRegion & subRegion ) override;
 
   /**
-   * @brief Recompute the BHP pressure that is used in the well constraints
-   * @param subRegion the well subregion containing all the primary and dependent fields
-   * @param targetIndex the targetIndex of the subRegion
+   * @brief Recompute the volumetric rates that are used in the constraints of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
+   */
+  virtual void updateVolRatesForConstraints( ElementRegionManager const & elemManager,
+                                             arrayView1d< string const > const & regionNames ) override;
+
+  /**
+   * @brief Recompute the BHP pressure that is used in the constraints of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
    */
-  virtual void updateBHPForConstraint( WellElementSubRegion & subRegion );
+  virtual void updateBHPForConstraints( ElementRegionManager const & elemManager,
+                                        arrayView1d< string const > const & regionNames ) override;
 
   /**
    * @brief Update fluid constitutive model state
@@ -153,12 +161,11 @@ public:
 
 
   /**
-   * @brief Recompute all dependent quantities from primary variables (including constitutive models) on the well
+   * @brief Recompute the density and the perforation rates from the primary variables on the well
    * @param meshLevel the mesh level
    * @param subRegion the well subRegion containing the well elements and their associated fields
-   * @param targetIndex the targetIndex of the subRegion
    */
-  virtual void updateSubRegionState( MeshLevel const & meshLevel, WellElementSubRegion & subRegion ) override;
+  virtual void updateSubRegionFluidState( MeshLevel const & meshLevel, WellElementSubRegion & subRegion ) override;
 
   /**
    * @brief assembles the flux terms for all connections between well elements
@@ -212,6 +219,16 @@ public:
                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                           arrayView1d< real64 > const & localRhs ) override;
 
+  /**
+   * @brief Switch the control of a well whose current constraint is no longer viable
+   * @param wellControls the controls of the well
+   * @param timeAtEndOfStep the time at which the new target is evaluated
+   * @param logSwitch flag to report the switch, only set on the rank that detected it
+   */
+  virtual void switchWellControl( WellControls & wellControls,
+                                  real64 const & timeAtEndOfStep,
+                                  bool const logSwitch ) const override;
+
   /**
    * @brief Backup current values of all constitutive fields that participate in the accumulation term
    * @param mesh reference to the mesh
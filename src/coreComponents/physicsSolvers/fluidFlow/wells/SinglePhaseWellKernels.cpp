@@ -661,6 +661,65 @@ RateInitializationKernel::
   } );
 }
 
+/******************************** VolRateConstraintKernel ********************************/
+
+void
+VolRateConstraintKernel::
+  launch( localIndex const numWells,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< integer const > const & useSurfaceConditions,
+          ElementViewConst< arrayView1d< real64 const > > const & connRate,
+          ElementViewConst< arrayView1d< real64 const > > const & dConnRate,
+          ElementViewConst< arrayView2d< real64 const > > const & dens,
+          ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+          arrayView1d< real64 > const & currentVolRate,
+          arrayView1d< real64 > const & dCurrentVolRate_dPres,
+          arrayView1d< real64 > const & dCurrentVolRate_dRate )
+{
+  forAll< parallelDevicePolicy<> >( numWells, [=] GEOSX_HOST_DEVICE ( localIndex const iwell )
+  {
+    localIndex const er = refElemRegion[iwell];
+    localIndex const esr = refElemSubRegion[iwell];
+    localIndex const iwelemRef = refElemIndex[iwell];
+
+    // the density has been evaluated at the conditions of the constraint (surface or reservoir)
+    real64 const densInv = 1.0 / dens[er][esr][iwelemRef][0];
+    currentVolRate[iwell] = ( connRate[er][esr][iwelemRef] + dConnRate[er][esr][iwelemRef] ) * densInv;
+    dCurrentVolRate_dPres[iwell] = -( useSurfaceConditions[iwell] == 0 ) * dDens_dPres[er][esr][iwelemRef][0] * currentVolRate[iwell] * densInv;
+    dCurrentVolRate_dRate[iwell] = densInv;
+  } );
+}
+
+/******************************** BHPConstraintKernel ********************************/
+
+void
+BHPConstraintKernel::
+  launch( localIndex const numWells,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< real64 const > const & refGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView2d< real64 const > > const & dens,
+          ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+          arrayView1d< real64 > const & currentBHP,
+          arrayView1d< real64 > const & dCurrentBHP_dPres )
+{
+  forAll< parallelDevicePolicy<> >( numWells, [=] GEOSX_HOST_DEVICE ( localIndex const iwell )
+  {
+    localIndex const er = refElemRegion[iwell];
+    localIndex const esr = refElemSubRegion[iwell];
+    localIndex const iwelemRef = refElemIndex[iwell];
+
+    real64 const diffGravCoef = refGravCoef[iwell] - wellElemGravCoef[er][esr][iwelemRef];
+    currentBHP[iwell] = pres[er][esr][iwelemRef] + dPres[er][esr][iwelemRef] + dens[er][esr][iwelemRef][0] * diffGravCoef;
+    dCurrentBHP_dPres[iwell] = 1.0 + dDens_dPres[er][esr][iwelemRef][0] * diffGravCoef;
+  } );
+}
 
 } // end namespace singlePhaseWellKernels
 
@@ -26,7 +26,9 @@
 #include "mesh/ElementRegionManager.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
+#include "physicsSolvers/fluidFlow/wells/SinglePhaseWellExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellSolverBaseExtrinsicData.hpp"
 
 namespace geosx
 {
@@ -302,6 +304,103 @@ struct RateInitializationKernel
 
 };
 
+/******************************** VolRateConstraintKernel ********************************/
+
+struct VolRateConstraintKernel
+{
+
+  using WellAccessors =
+    StencilAccessors< extrinsicMeshData::well::connectionRate,
+                      extrinsicMeshData::well::deltaConnectionRate >;
+
+  using WellFluidAccessors =
+    StencilMaterialAccessors< constitutive::SingleFluidBase,
+                              extrinsicMeshData::singlefluid::density,
+                              extrinsicMeshData::singlefluid::dDensity_dPressure >;
+
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  /**
+   * @brief Compute the volumetric rate of all the wells owned by this rank in a single launch
+   * @param[in] numWells the number of wells owned by this rank
+   * @param[in] refElemRegion the region index of the reference element of each well
+   * @param[in] refElemSubRegion the subregion index of the reference element of each well
+   * @param[in] refElemIndex the index of the reference element of each well
+   * @param[in] useSurfaceConditions for each well, 1 if the rate is evaluated at surface conditions
+   * @param[in] connRate the connection rates
+   * @param[in] dConnRate the increment of the connection rates
+   * @param[in] dens the fluid density, evaluated at the conditions of the constraint in the reference element
+   * @param[in] dDens_dPres the derivative of the fluid density wrt pressure
+   * @param[out] currentVolRate the volumetric rate of each well
+   * @param[out] dCurrentVolRate_dPres the derivative of the volumetric rate wrt pressure
+   * @param[out] dCurrentVolRate_dRate the derivative of the volumetric rate wrt connection rate
+   */
+  static void
+  launch( localIndex const numWells,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< integer const > const & useSurfaceConditions,
+          ElementViewConst< arrayView1d< real64 const > > const & connRate,
+          ElementViewConst< arrayView1d< real64 const > > const & dConnRate,
+          ElementViewConst< arrayView2d< real64 const > > const & dens,
+          ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+          arrayView1d< real64 > const & currentVolRate,
+          arrayView1d< real64 > const & dCurrentVolRate_dPres,
+          arrayView1d< real64 > const & dCurrentVolRate_dRate );
+
+};
+
+/******************************** BHPConstraintKernel ********************************/
+
+struct BHPConstraintKernel
+{
+
+  using WellAccessors =
+    StencilAccessors< extrinsicMeshData::well::pressure,
+                      extrinsicMeshData::well::deltaPressure,
+                      extrinsicMeshData::well::gravityCoefficient >;
+
+  using WellFluidAccessors =
+    StencilMaterialAccessors< constitutive::SingleFluidBase,
+                              extrinsicMeshData::singlefluid::density,
+                              extrinsicMeshData::singlefluid::dDensity_dPressure >;
+
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  /**
+   * @brief Compute the bottom-hole pressure of all the wells owned by this rank in a single launch
+   * @param[in] numWells the number of wells owned by this rank
+   * @param[in] refElemRegion the region index of the reference element of each well
+   * @param[in] refElemSubRegion the subregion index of the reference element of each well
+   * @param[in] refElemIndex the index of the reference element of each well
+   * @param[in] refGravCoef the gravity coefficient at the reference elevation of each well
+   * @param[in] pres the well element pressure
+   * @param[in] dPres the increment of the well element pressure
+   * @param[in] wellElemGravCoef the gravity coefficient of the well elements
+   * @param[in] dens the fluid density
+   * @param[in] dDens_dPres the derivative of the fluid density wrt pressure
+   * @param[out] currentBHP the bottom-hole pressure of each well
+   * @param[out] dCurrentBHP_dPres the derivative of the bottom-hole pressure wrt pressure
+   */
+  static void
+  launch( localIndex const numWells,
+          arrayView1d< localIndex const > const & refElemRegion,
+          arrayView1d< localIndex const > const & refElemSubRegion,
+          arrayView1d< localIndex const > const & refElemIndex,
+          arrayView1d< real64 const > const & refGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView2d< real64 const > > const & dens,
+          ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+          arrayView1d< real64 > const & currentBHP,
+          arrayView1d< real64 > const & dCurrentBHP_dPres );
+
+};
+
 
 /******************************** ResidualNormKernel ********************************/
 
@@ -18,6 +18,8 @@
 
 #include "WellSolverBase.hpp"
 
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "mesh/PerforationData.hpp"
 #include "mesh/WellElementRegion.hpp"
@@ -27,6 +29,8 @@
 #include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellSolverBaseExtrinsicData.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -39,7 +43,8 @@ WellSolverBase::WellSolverBase( string const & name,
   m_numDofPerWellElement( 0 ),
   m_numDofPerResElement( 0 ),
   m_currentTime( 0 ),
-  m_currentDt( 0 )
+  m_currentDt( 0 ),
+  m_hasSplitWells( false )
 {
   this->getWrapper< string >( viewKeyStruct::discretizationString() ).
     setInputFlag( InputFlags::FALSE );
@@ -188,19 +193,49 @@ void WellSolverBase::assembleSystem( real64 const time,
 
 void WellSolverBase::updateState( DomainPartition & domain )
 {
+  GEOSX_MARK_FUNCTION;
 
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
                                                 arrayView1d< string const > const & regionNames )
   {
-    mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                          WellElementSubRegion & subRegion )
+    ElementRegionManager & elemManager = mesh.getElemManager();
+
+    // evaluate the fluid of the reference elements at the conditions of the rate constraints
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                WellElementSubRegion & subRegion )
     {
-      updateSubRegionState( mesh, subRegion );
+      updateReferenceFluidState( subRegion );
     } );
+
+    // update volumetric rates for the constraints of all the wells at once
+    // note: this must be called before the fluid of the reference elements is updated at reservoir conditions
+    updateVolRatesForConstraints( elemManager, regionNames );
+
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                WellElementSubRegion & subRegion )
+    {
+      updateSubRegionFluidState( mesh, subRegion );
+    } );
+
+    // update the BHP for the constraints of all the wells at once
+    updateBHPForConstraints( elemManager, regionNames );
   } );
+}
+
+void WellSolverBase::updateSubRegionState( MeshLevel const & meshLevel,
+                                           WellElementSubRegion & subRegion )
+{
+  ElementRegionManager const & elemManager = meshLevel.getElemManager();
 
+  // restrict the constraint updates to the region containing this well
+  array1d< string > regionNames( 1 );
+  regionNames[0] = subRegion.getParent().getParent().getName();
 
+  updateReferenceFluidState( subRegion );
+  updateVolRatesForConstraints( elemManager, regionNames.toViewConst() );
+  updateSubRegionFluidState( meshLevel, subRegion );
+  updateBHPForConstraints( elemManager, regionNames.toViewConst() );
 }
 
 void WellSolverBase::initializePreSubGroups()
@@ -236,6 +271,9 @@ void WellSolverBase::initializePostInitialConditionsPreSubGroups()
 void WellSolverBase::precomputeData( DomainPartition & domain )
 {
   R1Tensor const gravVector = gravityVector();
+
+  // for each sub-group of this solver, 1 if this rank holds elements of the corresponding well
+  array1d< integer > hasWellElements( numSubGroups() );
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -272,8 +310,87 @@ void WellSolverBase::precomputeData( DomainPartition & domain )
       // set the reference well element where the BHP control is applied
       wellControls.setReferenceGravityCoef( refElev * gravVector[ 2 ] );
 
+      if( subRegion.size() > 0 )
+      {
+        hasWellElements[getWellControlsIndex( subRegion )] = 1;
+      }
+
     } );
   } );
+
+  // the control switches only need to be communicated if a well is split across ranks
+  array1d< integer > numRanksPerWell( hasWellElements.size() );
+  MpiWrapper::allReduce( hasWellElements.data(),
+                         numRanksPerWell.data(),
+                         LvArray::integerConversion< int >( hasWellElements.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                         MPI_COMM_GEOSX );
+  m_hasSplitWells = std::any_of( numRanksPerWell.begin(), numRanksPerWell.end(),
+                                 []( integer const numRanks ){ return numRanks > 1; } );
+}
+
+localIndex WellSolverBase::getWellControlsIndex( WellElementSubRegion const & subRegion ) const
+{ return this->getSubGroups().getIndex( subRegion.getWellControlsName() ); }
+
+std::vector< WellControls * >
+WellSolverBase::getLocallyOwnedWells( ElementRegionManager const & elemManager,
+                                      arrayView1d< string const > const & regionNames,
+                                      array1d< localIndex > & refElemRegion,
+                                      array1d< localIndex > & refElemSubRegion,
+                                      array1d< localIndex > & refElemIndex )
+{
+  std::vector< WellControls * > wellControls;
+  refElemRegion.resize( 0 );
+  refElemSubRegion.resize( 0 );
+  refElemIndex.resize( 0 );
+
+  elemManager.forElementSubRegionsComplete< WellElementSubRegion >( regionNames,
+                                                                    [&]( localIndex const,
+                                                                         localIndex const er,
+                                                                         localIndex const esr,
+                                                                         ElementRegionBase const &,
+                                                                         WellElementSubRegion const & subRegion )
+  {
+    // the rank that owns the reference well element is responsible for the constraints of the well
+    if( subRegion.isLocallyOwned() )
+    {
+      wellControls.emplace_back( &getWellControls( subRegion ) );
+      refElemRegion.emplace_back( er );
+      refElemSubRegion.emplace_back( esr );
+      refElemIndex.emplace_back( subRegion.getTopWellElementIndex() );
+    }
+  } );
+
+  return wellControls;
+}
+
+void WellSolverBase::applyWellControlSwitches( arrayView1d< integer const > const & controlHasSwitched )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the switch is only detected by the rank owning the well head, hence the reduction if a well is split
+  array1d< integer > globalControlHasSwitched;
+  if( m_hasSplitWells )
+  {
+    globalControlHasSwitched.resize( controlHasSwitched.size() );
+    MpiWrapper::allReduce( controlHasSwitched.data(),
+                           globalControlHasSwitched.data(),
+                           LvArray::integerConversion< int >( controlHasSwitched.size() ),
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ),
+                           MPI_COMM_GEOSX );
+  }
+  arrayView1d< integer const > const hasSwitched =
+    m_hasSplitWells ? globalControlHasSwitched.toViewConst() : controlHasSwitched;
+
+  real64 const timeAtEndOfStep = m_currentTime + m_currentDt;
+  forSubGroupsIndex< WellControls >( [&]( localIndex const iGroup,
+                                          WellControls & wellControls )
+  {
+    if( hasSwitched[iGroup] == 1 )
+    {
+      switchWellControl( wellControls, timeAtEndOfStep, controlHasSwitched[iGroup] == 1 );
+    }
+  } );
 }
 
 WellControls & WellSolverBase::getWellControls( WellElementSubRegion const & subRegion )
@@ -218,6 +218,16 @@ public:
                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                           arrayView1d< real64 > const & localRhs ) = 0;
 
+  /**
+   * @brief Switch the control of a well whose current constraint is no longer viable
+   * @param wellControls the controls of the well
+   * @param timeAtEndOfStep the time at which the new target is evaluated
+   * @param logSwitch flag to report the switch, only set on the rank that detected it
+   */
+  virtual void switchWellControl( WellControls & wellControls,
+                                  real64 const & timeAtEndOfStep,
+                                  bool const logSwitch ) const = 0;
+
   /**
    * @brief Recompute all dependent quantities from primary variables (including constitutive models)
    * @param domain the domain containing the mesh and fields
@@ -225,13 +235,45 @@ public:
   virtual void updateState( DomainPartition & domain ) override;
 
   /**
-   * @brief Recompute all dependent quantities from primary variables (including constitutive models)
+   * @brief Recompute all dependent quantities from primary variables (including constitutive models) on a single well
+   * @param meshLevel the mesh level
+   * @param subRegion the well subRegion containing the well elements and their associated fields
+   *
+   * This goes through the same steps as updateState, restricted to the region of this well.
+   */
+  void updateSubRegionState( MeshLevel const & meshLevel,
+                             WellElementSubRegion & subRegion );
+
+  /**
+   * @brief Evaluate the fluid in the reference element of the well at the conditions of the rate constraints
+   * @param subRegion the well subRegion containing the well elements and their associated fields
+   * @note this must be called before the volumetric rates are computed, and before updateSubRegionFluidState
+   */
+  virtual void updateReferenceFluidState( WellElementSubRegion & subRegion ) = 0;
+
+  /**
+   * @brief Recompute the volumetric rates used in the constraints of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
+   */
+  virtual void updateVolRatesForConstraints( ElementRegionManager const & elemManager,
+                                             arrayView1d< string const > const & regionNames ) = 0;
+
+  /**
+   * @brief Recompute the fluid properties and the perforation rates of a well from the primary variables
    * @param meshLevel the mesh level
    * @param subRegion the well subRegion containing the well elements and their associated fields
-   * @param targetIndex the targetIndex of the subRegion
    */
-  virtual void updateSubRegionState( MeshLevel const & meshLevel,
-                                     WellElementSubRegion & subRegion ) = 0;
+  virtual void updateSubRegionFluidState( MeshLevel const & meshLevel,
+                                          WellElementSubRegion & subRegion ) = 0;
+
+  /**
+   * @brief Recompute the BHP used in the constraints of all the wells owned by this rank
+   * @param elemManager the element region manager
+   * @param regionNames the names of the well regions
+   */
+  virtual void updateBHPForConstraints( ElementRegionManager const & elemManager,
+                                        arrayView1d< string const > const & regionNames ) = 0;
 
   /**
    * @brief Backup current values of all constitutive fields that participate in the accumulation term
@@ -268,11 +310,37 @@ protected:
    */
   virtual void initializeWells( DomainPartition & domain ) = 0;
 
+  /**
+   * @brief Get the index of the controls of a well among the sub-groups of this solver
+   * @param subRegion the well subRegion whose controls are requested
+   * @return the index of the controls, identical on all ranks
+   */
+  localIndex getWellControlsIndex( WellElementSubRegion const & subRegion ) const;
+
+  /**
+   * @brief Get the wells whose reference element is owned by this rank
+   * @param[in] elemManager the element region manager
+   * @param[in] regionNames the names of the well regions
+   * @param[out] refElemRegion the region index of the reference element of each well
+   * @param[out] refElemSubRegion the subregion index of the reference element of each well
+   * @param[out] refElemIndex the index of the reference element of each well
+   * @return the controls of each well
+   */
+  std::vector< WellControls * > getLocallyOwnedWells( ElementRegionManager const & elemManager,
+                                                      arrayView1d< string const > const & regionNames,
+                                                      array1d< localIndex > & refElemRegion,
+                                                      array1d< localIndex > & refElemSubRegion,
+                                                      array1d< localIndex > & refElemIndex );
+
   /**
    * @brief Check if the controls are viable; if not, switch the controls
-   * @param domain the domain containing the well manager to access individual wells
+   * @param controlHasSwitched for each sub-group of this solver, 1 if the rank owning the well head has detected a switch
+   *
+   * If a well is split across ranks, the flags of all the wells are reduced with a single collective, so that
+   * the ranks holding a piece of that well all switch to the same control in the same Newton iteration.
+   * Otherwise, the switch is only applied by the rank holding the well, without communication.
    */
-  //virtual void CheckWellControlSwitch( DomainPartition & domain ) = 0;
+  void applyWellControlSwitches( arrayView1d< integer const > const & controlHasSwitched );
 
   /// name of the flow solver
   string m_flowSolverName;
@@ -289,6 +357,9 @@ protected:
   /// copy of the time step size saved in this class for residual normalization
   real64 m_currentDt;
 
+  /// flag indicating whether at least one well has elements on more than one rank
+  bool m_hasSplitWells;
+
 };
 
 }
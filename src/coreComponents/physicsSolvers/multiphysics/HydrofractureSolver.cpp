@@ -182,11 +182,17 @@ real64 HydrofractureSolver::solverStep( real64 const & time_n,
       int locallyFractured = 0;
       int globallyFractured = 0;
 
-      setupSystem( domain,
-                   m_dofManager,
-                   m_localMatrix,
-                   m_rhs,
-                   m_solution );
+      // the dofs and the sparsity pattern only need to be rebuilt after a topology change;
+      // setupSystem is collective, so it is called on all ranks as soon as one of them has changed
+      int const locallyChangedTopology = ( countTopologyObjects( domain ) != m_numTopologyObjectsAtSetup ) ? 1 : 0;
+      if( MpiWrapper::max( locallyChangedTopology ) > 0 )
+      {
+        setupSystem( domain,
+                     m_dofManager,
+                     m_localMatrix,
+                     m_rhs,
+                     m_solution );
+      }
 
       // currently the only method is implicit time integration
       dtReturn = nonlinearImplicitStep( time_n, dt, cycleNumber, domain );
@@ -528,6 +534,24 @@ void HydrofractureSolver::setupSystem( DomainPartition & domain,
   solution.create( numLocalRows, MPI_COMM_GEOSX );
 
   setUpDflux_dApertureMatrix( domain, dofManager, localMatrix );
+
+  m_numTopologyObjectsAtSetup = countTopologyObjects( domain );
+}
+
+localIndex HydrofractureSolver::countTopologyObjects( DomainPartition & domain ) const
+{
+  localIndex numObjects = 0;
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel const & meshLevel,
+                                                arrayView1d< string const > const & )
+  {
+    numObjects += meshLevel.getNodeManager().size();
+    meshLevel.getElemManager().forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+    {
+      numObjects += subRegion.size();
+    } );
+  } );
+  return numObjects;
 }
 
 void HydrofractureSolver::addFluxApertureCouplingNNZ( DomainPartition & domain,
@@ -204,6 +204,17 @@ protected:
 
 private:
 
+  /**
+   * @brief Count the mesh objects created by the surface generation
+   * @param domain the physical domain object
+   * @return the number of nodes and fracture elements of the mesh
+   *
+   * The surface generation only adds objects to the mesh, so the local topology changed since the
+   * last call to setupSystem if and only if this count changed. The count is local to the rank,
+   * so the result must be reduced over all ranks before deciding to call setupSystem.
+   */
+  localIndex countTopologyObjects( DomainPartition & domain ) const;
+
   CouplingTypeOption m_couplingTypeOption;
 
   // name of the contact relation
@@ -223,6 +234,9 @@ private:
   integer m_maxNumResolves;
   integer m_numResolves[2];
 
+  /// result of countTopologyObjects when the linear system was last set up
+  localIndex m_numTopologyObjectsAtSetup = -1;
+
 };
 
 ENUM_STRINGS( HydrofractureSolver::CouplingTypeOption,
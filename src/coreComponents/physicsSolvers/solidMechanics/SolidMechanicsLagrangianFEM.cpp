@@ -185,23 +185,30 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
       setRegisteringObjects( this->getName()).
       setDescription( "An array that holds the mass on the nodes." );
 
-    nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::vTildeString() ).
-      setPlotLevel( PlotLevel::NOPLOT ).
-      setRegisteringObjects( this->getName()).
-      setDescription( "An array that holds the velocity predictors on the nodes." ).
-      reference().resizeDimension< 1 >( 3 );
-
-    nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::uhatTildeString() ).
-      setPlotLevel( PlotLevel::NOPLOT ).
-      setRegisteringObjects( this->getName()).
-      setDescription( "An array that holds the incremental displacement predictors on the nodes." ).
-      reference().resizeDimension< 1 >( 3 );
+    // The predictors and the contact force are only used by some configurations: they are allocated on first write.
+    Wrapper< array2d< real64 > > & vTilde =
+      nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::vTildeString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the velocity predictors on the nodes." );
+    vTilde.reference().resizeDimension< 1 >( 3 );
+    vTilde.setLazyAllocation();
 
-    nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::contactForceString() ).
-      setPlotLevel( PlotLevel::LEVEL_0 ).
-      setRegisteringObjects( this->getName()).
-      setDescription( "An array that holds the contact force." ).
-      reference().resizeDimension< 1 >( 3 );
+    Wrapper< array2d< real64 > > & uhatTilde =
+      nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::uhatTildeString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the incremental displacement predictors on the nodes." );
+    uhatTilde.reference().resizeDimension< 1 >( 3 );
+    uhatTilde.setLazyAllocation();
+
+    Wrapper< array2d< real64 > > & contactForce =
+      nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::contactForceString() ).
+        setPlotLevel( PlotLevel::LEVEL_0 ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the contact force." );
+    contactForce.reference().resizeDimension< 1 >( 3 );
+    contactForce.setLazyAllocation();
 
     Group & nodeSets = nodes.sets();
     nodeSets.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).
@@ -92,7 +92,6 @@ struct ExplicitKernel
                              arrayView3d< real64 const, solid::STRESS_USD > const & stress,
                              real64 ( & force )[ 3 ] )
   {
-    GEOSX_MARK_FUNCTION;
     localIndex const & a = targetNode;
 
     //Compute Quadrature
@@ -30,6 +30,7 @@
 #include "mesh/SurfaceElementRegion.hpp"
 #include "mesh/ExtrinsicMeshData.hpp"
 #include "mesh/utilities/ComputationalGeometry.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEMKernels.hpp"
 #include "mesh/simpleGeometricObjects/GeometricObjectManager.hpp"
 #include "mesh/simpleGeometricObjects/BoundedPlane.hpp"
@@ -125,81 +126,122 @@ void EmbeddedSurfaceGenerator::initializePostSubGroups()
 
   NewObjectLists newObjects;
 
+  // Index the cells once for all the fracture planes
+  ElementSpatialIndex const cellElemIndex( meshLevel );
+
+  // Views on the cell data read by the sign test, built once for all the fracture planes
+  using NodeMapViewType = arrayView2d< localIndex const, cells::NODE_MAP_USD >;
+  ElementRegionManager::ElementViewAccessor< NodeMapViewType > const cellToNodesAccessor =
+    elemManager.constructViewAccessor< CellElementSubRegion::NodeMapType, NodeMapViewType >( ElementSubRegionBase::viewKeyStruct::nodeListString() );
+  ElementRegionManager::ElementViewConst< NodeMapViewType > const cellToNodesView = cellToNodesAccessor.toNestedViewConst();
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const cellGhostRankAccessor =
+    elemManager.constructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString() );
+  ElementRegionManager::ElementViewConst< arrayView1d< integer const > > const cellGhostRankView = cellGhostRankAccessor.toNestedViewConst();
+
   // Loop over all the fracture planes
   geometricObjManager.forSubGroups< BoundedPlane >( [&]( BoundedPlane & fracture )
   {
     /* 1. Find out if an element is cut by the fracture or not.
-     * Loop over all the elements and for each one of them loop over the nodes and compute the
+     * Loop over the candidate elements and for each one of them loop over the nodes and compute the
      * dot product between the distance between the plane center and the node and the normal
      * vector defining the plane. If two scalar products have different signs the plane cuts the
      * cell. If a nodes gives a 0 dot product it has to be neglected or the method won't work.
      */
     real64 const planeCenter[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( fracture.getCenter() );
     real64 const normalVector[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( fracture.getNormal() );
-    // Initialize variables
-    globalIndex nodeIndex;
-    integer isPositive, isNegative;
-    real64 distVec[ 3 ];
 
-    elemManager.forElementSubRegionsComplete< CellElementSubRegion >(
-      [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+    // only the cells whose bounding box is crossed by the plane, within the extent of the fracture, can be cut
+    real64 boxMin[3], boxMax[3];
+    fracture.getBoundingBox( boxMin, boxMax );
+
+    array1d< localIndex > candidateRegion;
+    array1d< localIndex > candidateSubRegion;
+    array1d< localIndex > candidateCell;
+    cellElemIndex.forElementsCrossingPlane( normalVector, planeCenter, boxMin, boxMax, [&]( localIndex const er,
+                                                                                            localIndex const esr,
+                                                                                            localIndex const cellIndex )
     {
-      arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
-      FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
+      candidateRegion.emplace_back( er );
+      candidateSubRegion.emplace_back( esr );
+      candidateCell.emplace_back( cellIndex );
+    } );
 
-      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    // the sign test only reads the mesh, so that the candidates are checked in parallel
+    arrayView1d< localIndex const > const candidateRegionView = candidateRegion.toViewConst();
+    arrayView1d< localIndex const > const candidateSubRegionView = candidateSubRegion.toViewConst();
+    arrayView1d< localIndex const > const candidateCellView = candidateCell.toViewConst();
+    array1d< integer > isCut( candidateCell.size() );
+    arrayView1d< integer > const isCutView = isCut.toView();
+    forAll< parallelHostPolicy >( candidateCell.size(), [=] ( localIndex const k )
+    {
+      localIndex const er = candidateRegionView[k];
+      localIndex const esr = candidateSubRegionView[k];
+      localIndex const cellIndex = candidateCellView[k];
+      NodeMapViewType const & cellToNodes = cellToNodesView[er][esr];
 
-      forAll< serialPolicy >( subRegion.size(), [ &, ghostRank,
-                                                  cellToNodes,
-                                                  nodesCoord ] ( localIndex const cellIndex )
+      isCutView[k] = 0;
+      if( cellGhostRankView[er][esr][cellIndex] < 0 )
       {
-        if( ghostRank[cellIndex] < 0 )
+        integer isPositive = 0;
+        integer isNegative = 0;
+        for( localIndex kn = 0; kn < cellToNodes.size( 1 ); kn++ )
         {
-          isPositive = 0;
-          isNegative = 0;
-          for( localIndex kn = 0; kn < subRegion.numNodesPerElement(); kn++ )
+          real64 distVec[ 3 ] = LVARRAY_TENSOROPS_INIT_LOCAL_3( nodesCoord[cellToNodes[cellIndex][kn]] );
+          LvArray::tensorOps::subtract< 3 >( distVec, planeCenter );
+          // check if the dot product is zero
+          real64 const dot = LvArray::tensorOps::AiBi< 3 >( distVec, normalVector );
+          if( dot > 0 )
           {
-            nodeIndex = cellToNodes[cellIndex][kn];
-            LvArray::tensorOps::copy< 3 >( distVec, nodesCoord[nodeIndex] );
-            LvArray::tensorOps::subtract< 3 >( distVec, planeCenter );
-            // check if the dot product is zero
-            if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) > 0 )
-            {
-              isPositive = 1;
-            }
-            else if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) < 0 )
-            {
-              isNegative = 1;
-            }
-          } // end loop over nodes
-          if( isPositive * isNegative == 1 )
+            isPositive = 1;
+          }
+          else if( dot < 0 )
           {
-            bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
-                                                                         esr,
-                                                                         er,
-                                                                         nodeManager,
-                                                                         embSurfNodeManager,
-                                                                         edgeManager,
-                                                                         cellToEdges,
-                                                                         &fracture );
+            isNegative = 1;
+          }
+        } // end loop over nodes
+        isCutView[k] = isPositive * isNegative;
+      }
+    } );
 
-            if( added )
-            {
-              GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
+    // the embedded elements are then created in the order of the candidates, as their creation modifies the mesh
+    for( localIndex k = 0; k < candidateCell.size(); ++k )
+    {
+      if( isCut[k] == 0 )
+      {
+        continue;
+      }
 
-              // Add the information to the CellElementSubRegion
-              subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
+      localIndex const er = candidateRegion[k];
+      localIndex const esr = candidateSubRegion[k];
+      localIndex const cellIndex = candidateCell[k];
+      CellElementSubRegion & subRegion = elemManager.getRegion( er ).getSubRegion< CellElementSubRegion >( esr );
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
+      FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
 
-              embeddedSurfaceSubRegion.computeConnectivityIndex( localNumberOfSurfaceElems, cellToNodes, nodesCoord );
+      bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
+                                                                   esr,
+                                                                   er,
+                                                                   nodeManager,
+                                                                   embSurfNodeManager,
+                                                                   edgeManager,
+                                                                   cellToEdges,
+                                                                   &fracture );
 
-              newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
+      if( added )
+      {
+        GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
 
-              localNumberOfSurfaceElems++;
-            }
-          }
-        }
-      } );// end loop over cells
-    } );// end loop over subregions
+        // Add the information to the CellElementSubRegion
+        subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
+
+        embeddedSurfaceSubRegion.computeConnectivityIndex( localNumberOfSurfaceElems, cellToNodes, nodesCoord );
+
+        newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
+
+        localNumberOfSurfaceElems++;
+      }
+    } // end loop over cells
   } );// end loop over thick planes
 
   // add all new nodes to newObject list
@@ -287,54 +329,34 @@ void EmbeddedSurfaceGenerator::setGlobalIndices( ElementRegionManager & elemMana
                                                  EmbeddedSurfaceNodeManager & embSurfNodeManager,
                                                  EmbeddedSurfaceSubRegion & embeddedSurfaceSubRegion )
 {
-  // Add new globalIndices
-  int const thisRank = MpiWrapper::commRank( MPI_COMM_GEOSX );
-  int const commSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
-
-  localIndex_array numberOfSurfaceElemsPerRank( commSize );
-  localIndex_array globalIndexOffset( commSize );
-  MpiWrapper::allGather( embeddedSurfaceSubRegion.size(), numberOfSurfaceElemsPerRank );
-
-  globalIndexOffset[0] = 0; // offSet for the globalIndex
-  localIndex totalNumberOfSurfaceElements = numberOfSurfaceElemsPerRank[ 0 ];  // Sum across all ranks
-  for( int rank = 1; rank < commSize; ++rank )
-  {
-    globalIndexOffset[rank] = globalIndexOffset[rank - 1] + numberOfSurfaceElemsPerRank[rank - 1];
-    totalNumberOfSurfaceElements += numberOfSurfaceElemsPerRank[rank];
-  }
+  // Add new globalIndices: the objects of each rank are numbered contiguously after those of the lower ranks
+  localIndex const numSurfaceElems = embeddedSurfaceSubRegion.size();
+  globalIndex const elemIndexOffset = MpiWrapper::prefixSum< globalIndex >( numSurfaceElems ) + elemManager.maxGlobalIndex() + 1;
+  globalIndex const totalNumberOfSurfaceElements = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numSurfaceElems ) );
 
   GEOSX_LOG_LEVEL_RANK_0( 1, "Number of embedded surface elements: " << totalNumberOfSurfaceElements );
 
-  arrayView1d< globalIndex > const & elemLocalToGlobal = embeddedSurfaceSubRegion.localToGlobalMap();
-
-  forAll< serialPolicy >( embeddedSurfaceSubRegion.size(), [&, elemLocalToGlobal] ( localIndex const ei )
+  arrayView1d< globalIndex > const elemLocalToGlobal = embeddedSurfaceSubRegion.localToGlobalMap();
+  forAll< parallelHostPolicy >( numSurfaceElems, [=] ( localIndex const ei )
   {
-    elemLocalToGlobal( ei ) = ei + globalIndexOffset[ thisRank ] + elemManager.maxGlobalIndex() + 1;
-    embeddedSurfaceSubRegion.updateGlobalToLocalMap( ei );
+    elemLocalToGlobal[ ei ] = ei + elemIndexOffset;
   } );
+  embeddedSurfaceSubRegion.constructGlobalToLocalMap();
 
   embeddedSurfaceSubRegion.setMaxGlobalIndex();
 
   elemManager.setMaxGlobalIndex();
 
   // Nodes global indices
-  localIndex_array numberOfNodesPerRank( commSize );
-  MpiWrapper::allGather( embSurfNodeManager.size(), numberOfNodesPerRank );
-
-  globalIndexOffset[0] = 0; // offSet for the globalIndex
-  localIndex totalNumberOfNodes = numberOfNodesPerRank[ 0 ];  // Sum across all ranks
-  for( int rank = 1; rank < commSize; ++rank )
-  {
-    globalIndexOffset[rank] = globalIndexOffset[rank - 1] + numberOfNodesPerRank[rank - 1];
-    totalNumberOfNodes += numberOfNodesPerRank[rank];
-  }
+  localIndex const numNodes = embSurfNodeManager.size();
+  globalIndex const nodeIndexOffset = MpiWrapper::prefixSum< globalIndex >( numNodes );
 
-  arrayView1d< globalIndex > const & nodesLocalToGlobal = embSurfNodeManager.localToGlobalMap();
-  forAll< serialPolicy >( embSurfNodeManager.size(), [=, &embSurfNodeManager, &globalIndexOffset] ( localIndex const ni )
+  arrayView1d< globalIndex > const nodesLocalToGlobal = embSurfNodeManager.localToGlobalMap();
+  forAll< parallelHostPolicy >( numNodes, [=] ( localIndex const ni )
   {
-    nodesLocalToGlobal( ni ) = ni + globalIndexOffset[ thisRank ];
-    embSurfNodeManager.updateGlobalToLocalMap( ni );
+    nodesLocalToGlobal[ ni ] = ni + nodeIndexOffset;
   } );
+  embSurfNodeManager.constructGlobalToLocalMap();
 }
 
 void EmbeddedSurfaceGenerator::addEmbeddedElementsToSets( ElementRegionManager const & elemManager,
@@ -208,6 +208,12 @@ SurfaceGenerator::SurfaceGenerator( const string & name,
   registerWrapper( viewKeyStruct::trailingFacesString(), &m_trailingFaces ).
     setDescription( "Set containing all the trailing faces" );
 
+  registerWrapper( viewKeyStruct::splitNodesString(), &m_splitNodes ).
+    setDescription( "Set containing all the nodes created by the splitting of a node" );
+
+  registerWrapper( viewKeyStruct::splitFacesString(), &m_splitFaces ).
+    setDescription( "Set containing all the faces created by the splitting of a face" );
+
 
   this->getWrapper< string >( viewKeyStruct::discretizationString() ).
     setInputFlag( InputFlags::FALSE );
@@ -558,12 +564,14 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
 
   // We do this here to get the nodesToRupturedFaces etc.
   // The fail stress check inside has been disabled
+  std::vector< localIndex > frontNodes;
   postUpdateRuptureStates( nodeManager,
                            edgeManager,
                            faceManager,
                            elementManager,
                            nodesToRupturedFaces,
-                           edgesToRupturedFaces );
+                           edgesToRupturedFaces,
+                           frontNodes );
 
   int rval = 0;
   //  array1d<MaterialBaseStateDataT*>&  temp = elementManager.m_ElementRegions["PM1"].m_materialStates;
@@ -575,28 +583,47 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
     ModifiedObjectLists modifiedObjects;
     if( color==tileColor )
     {
-      for( localIndex a=0; a<nodeManager.size(); ++a )
+      // A node is split as long as a separation path is found around it
+      auto splitNode = [&]( localIndex const a )
       {
-        int didSplit = 0;
-        if( isNodeGhost[a]<0 &&
-            nodeToElementMap.sizeOfArray( a )>1 )
+        int didSplit = 1;
+        while( didSplit > 0 &&
+               isNodeGhost[a]<0 &&
+               nodeToElementMap.sizeOfArray( a )>1 )
         {
-          didSplit += processNode( a,
-                                   time_np1,
-                                   nodeManager,
-                                   edgeManager,
-                                   faceManager,
-                                   elementManager,
-                                   nodesToRupturedFaces,
-                                   edgesToRupturedFaces,
-                                   elementManager,
-                                   modifiedObjects, prefrac );
-          if( didSplit > 0 )
-          {
-            rval += didSplit;
-            --a;
-          }
+          didSplit = processNode( a,
+                                  time_np1,
+                                  nodeManager,
+                                  edgeManager,
+                                  faceManager,
+                                  elementManager,
+                                  nodesToRupturedFaces,
+                                  edgesToRupturedFaces,
+                                  elementManager,
+                                  modifiedObjects, prefrac );
+          rval += didSplit;
         }
+      };
+
+      // Only the nodes of the fracture front can be split (see findFracturePlanes), then the nodes created
+      // by the splits, in the same order as a sweep over all the nodes.
+      localIndex const numNodesBeforeSplit = nodeManager.size();
+      for( localIndex const a : frontNodes )
+      {
+        splitNode( a );
+      }
+      for( localIndex a = numNodesBeforeSplit; a < nodeManager.size(); ++a )
+      {
+        splitNode( a );
+      }
+
+      for( localIndex const newNodeIndex : modifiedObjects.newNodes )
+      {
+        m_splitNodes.insert( newNodeIndex );
+      }
+      for( localIndex const newFaceIndex : modifiedObjects.newFaces )
+      {
+        m_splitFaces.insert( newFaceIndex );
       }
     }
 
@@ -731,6 +758,7 @@ void SurfaceGenerator::synchronizeTipSets ( FaceManager & faceManager,
     GEOSX_ERROR_IF( parentNodeIndex == -1, "parentNodeIndex should not be -1" );
 
     m_tipNodes.remove( parentNodeIndex );
+    m_splitNodes.insert( nodeIndex );
   }
 
   arrayView1d< integer const > const & faceIsExternal = faceManager.isExternal();
@@ -788,6 +816,7 @@ void SurfaceGenerator::synchronizeTipSets ( FaceManager & faceManager,
     localIndex const parentFaceIndex = parentFaceIndices[faceIndex];
     GEOSX_ERROR_IF( parentFaceIndex == -1, "parentFaceIndex should not be -1" );
 
+    m_splitFaces.insert( faceIndex );
     m_trailingFaces.insert( parentFaceIndex );
     m_tipFaces.remove( parentFaceIndex );
 
@@ -2705,9 +2734,26 @@ void SurfaceGenerator::identifyRupturedFaces( DomainPartition const & domain,
 //    {
     arrayView1d< integer > const & isEdgeGhost = edgeManager.ghostRank();
     ModifiedObjectLists modifiedObjects;
+
+    // Only the edges of the split faces can be along the fracture tip (see checkEdgeSplitability)
+    arrayView1d< localIndex const > const & parentFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
+    ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager.edgeList().toViewConst();
+    std::vector< localIndex > frontEdges;
+    for( localIndex const childFaceIndex : m_splitFaces )
+    {
+      for( localIndex const faceIndex : { childFaceIndex, parentFaceIndices[childFaceIndex] } )
+      {
+        for( localIndex const edgeIndex : faceToEdgeMap[ faceIndex ] )
+        {
+          frontEdges.emplace_back( edgeIndex );
+        }
+      }
+    }
+    frontEdges.resize( LvArray::sortedArrayManipulation::makeSortedUnique( frontEdges.begin(), frontEdges.end() ) );
+
 //    if( partition.Color() == color )
     {
-      for( localIndex iEdge = 0; iEdge != edgeManager.size(); ++iEdge )
+      for( localIndex const iEdge : frontEdges )
       {
 
         if( isEdgeGhost[iEdge] < 0 )
@@ -4230,7 +4276,8 @@ void SurfaceGenerator::postUpdateRuptureStates( NodeManager const & nodeManager,
                                                 FaceManager const & faceManager,
                                                 ElementRegionManager const & GEOSX_UNUSED_PARAM( elementManager ),
                                                 std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                                std::vector< std::set< localIndex > > & edgesToRupturedFaces )
+                                                std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                                std::vector< localIndex > & frontNodes )
 {
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
   ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager.edgeList().toViewConst();
@@ -4239,6 +4286,7 @@ void SurfaceGenerator::postUpdateRuptureStates( NodeManager const & nodeManager,
 
   arrayView1d< integer const > const & faceRuptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
   arrayView1d< localIndex const > const & faceParentIndex = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
+  arrayView1d< localIndex const > const & nodeParentIndex = nodeManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
   // assign the values of the nodeToRupturedFaces and edgeToRupturedFaces arrays.
   for( localIndex kf=0; kf<faceManager.size(); ++kf )
@@ -4254,6 +4302,10 @@ void SurfaceGenerator::postUpdateRuptureStates( NodeManager const & nodeManager,
         {
           const localIndex nodeIndex = faceToNodeMap( kf, a );
           nodesToRupturedFaces[nodeIndex].insert( faceIndex );
+          if( nodeParentIndex[nodeIndex] == -1 )
+          {
+            frontNodes.emplace_back( nodeIndex );
+          }
         }
 
         for( localIndex a=0; a<faceToEdgeMap.sizeOfArray( kf ); ++a )
@@ -4264,6 +4316,17 @@ void SurfaceGenerator::postUpdateRuptureStates( NodeManager const & nodeManager,
       }
     }
   }
+
+  // findFracturePlanes looks for the ruptured faces of the original node, so the copies of a node attached to
+  // a ruptured face are also part of the front
+  for( localIndex const nodeIndex : m_splitNodes )
+  {
+    if( !nodesToRupturedFaces[ ObjectManagerBase::getParentRecusive( nodeParentIndex, nodeIndex ) ].empty() )
+    {
+      frontNodes.emplace_back( nodeIndex );
+    }
+  }
+  frontNodes.resize( LvArray::sortedArrayManipulation::makeSortedUnique( frontNodes.begin(), frontNodes.end() ) );
 }
 
 int SurfaceGenerator::checkEdgeSplitability( localIndex const edgeID,
@@ -255,13 +255,16 @@ private:
    * @param elementManager
    * @param nodesToRupturedFaces
    * @param edgesToRupturedFaces
+   * @param frontNodes sorted list of the nodes that may be split: the nodes attached to a ruptured face, and the nodes
+   *                   previously split from them
    */
   void postUpdateRuptureStates( NodeManager const & nodeManager,
                                 EdgeManager const & edgeManager,
                                 FaceManager const & faceManager,
                                 ElementRegionManager const & elementManager,
                                 std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                std::vector< std::set< localIndex > > & edgesToRupturedFaces );
+                                std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                std::vector< localIndex > & frontNodes );
 
   /**
    *
@@ -509,6 +512,8 @@ private:
     constexpr static char const * tipEdgesString() { return "tipEdges"; }
     constexpr static char const * tipFacesString() { return "tipFaces"; }
     constexpr static char const * trailingFacesString() { return "trailingFaces"; }
+    constexpr static char const * splitNodesString() { return "splitNodes"; }
+    constexpr static char const * splitFacesString() { return "splitFaces"; }
     constexpr static char const * fractureRegionNameString() { return "fractureRegion"; }
     constexpr static char const * mpiCommOrderString() { return "mpiCommOrder"; }
 
@@ -573,6 +578,12 @@ private:
 
   SortedArray< localIndex > m_trailingFaces;
 
+  /// nodes created by the splitting of a node, used to only visit the fracture front in separationDriver
+  SortedArray< localIndex > m_splitNodes;
+
+  /// faces created by the splitting of a face, used to only visit the fracture front in identifyRupturedFaces
+  SortedArray< localIndex > m_splitFaces;
+
   SortedArray< localIndex > m_faceElemsRupturedThisSolve;
 
 };
@@ -20,6 +20,7 @@
 #define GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICWAVEEQUATIONSEMKERNEL_HPP_
 
 #include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 
 
 namespace geosx
@@ -128,11 +129,44 @@ struct PrecomputeSourceAndReceiverKernel
     return pulse;
   }
 
+  /**
+   * @brief Collect, for each point, the elements of a subRegion whose bounding box contains it
+   * @param[in] elemIndex the spatial index of the cell elements of the mesh level
+   * @param[in] er the index of the region of the subRegion
+   * @param[in] esr the index of the subRegion in its region
+   * @param[in] coordinates coordinates of the points
+   * @return the candidate elements of each point, sorted by element index
+   */
+  static ArrayOfArrays< localIndex >
+  collectCandidates( ElementSpatialIndex const & elemIndex,
+                     localIndex const er,
+                     localIndex const esr,
+                     arrayView2d< real64 const > const & coordinates )
+  {
+    ArrayOfArrays< localIndex > candidates;
+    candidates.resize( coordinates.size( 0 ) );
+    for( localIndex i = 0; i < coordinates.size( 0 ); ++i )
+    {
+      elemIndex.forElementsContainingPoint( coordinates[i], [&]( localIndex const elemRegion,
+                                                                 localIndex const elemSubRegion,
+                                                                 localIndex const k )
+      {
+        if( elemRegion == er && elemSubRegion == esr )
+        {
+          candidates.emplaceBack( i, k );
+        }
+      } );
+    }
+    return candidates;
+  }
+
   /**
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] elemIndex the spatial index of the cell elements of the mesh level
+   * @param[in] er the index of the region of the subRegion
+   * @param[in] esr the index of the subRegion in its region
    * @param[in] numNodesPerElem number of nodes per element
    * @param[in] X coordinates of the nodes
    * @param[in] elemsToNodes map from element to nodes
@@ -147,10 +181,15 @@ struct PrecomputeSourceAndReceiverKernel
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
    * @param[out] receiverNodeConstants constant part of the receiver term
+   * @details The spatial index is a host structure: it is only used on the host to collect the few elements
+   *   whose bounding box contains each source and receiver. The exact location in these candidates and the
+   *   precomputation of the terms are then launched with @p EXEC_POLICY, one thread per source or receiver.
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( ElementSpatialIndex const & elemIndex,
+          localIndex const er,
+          localIndex const esr,
           localIndex const numNodesPerElem,
           arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X,
           arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
@@ -170,24 +209,27 @@ struct PrecomputeSourceAndReceiverKernel
           real64 const timeSourceFrequency,
           localIndex const rickerOrder )
   {
+    ArrayOfArrays< localIndex > const sourceCandidates = collectCandidates( elemIndex, er, esr, sourceCoordinates );
+    ArrayOfArrays< localIndex > const receiverCandidates = collectCandidates( elemIndex, er, esr, receiverCoordinates );
+    ArrayOfArraysView< localIndex const > const sourceElems = sourceCandidates.toViewConst();
+    ArrayOfArraysView< localIndex const > const receiverElems = receiverCandidates.toViewConst();
 
-    forAll< EXEC_POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
-    {
-      real64 const center[3] = { elemCenter[k][0],
-                                 elemCenter[k][1],
-                                 elemCenter[k][2] };
-
-      // Step 1: locate the sources, and precompute the source term
+    // Step 1: locate the sources, and precompute the source term
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+    /// loop over all the source that haven't been found yet
+    forAll< EXEC_POLICY >( sourceCoordinates.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const isrc )
+    {
+      if( sourceIsLocal[isrc] == 0 )
       {
-        if( sourceIsLocal[isrc] == 0 )
-        {
-          real64 const coords[3] = { sourceCoordinates[isrc][0],
-                                     sourceCoordinates[isrc][1],
-                                     sourceCoordinates[isrc][2] };
+        real64 const coords[3] = { sourceCoordinates[isrc][0],
+                                   sourceCoordinates[isrc][1],
+                                   sourceCoordinates[isrc][2] };
 
+        for( localIndex const k : sourceElems[isrc] )
+        {
+          real64 const center[3] = { elemCenter[k][0],
+                                     elemCenter[k][1],
+                                     elemCenter[k][2] };
           real64 coordsOnRefElem[3]{};
           bool const sourceFound =
             computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
@@ -214,22 +256,29 @@ struct PrecomputeSourceAndReceiverKernel
               real64 const time = cycle*dt;
               sourceValue[cycle][isrc] = evaluateRicker( time, timeSourceFrequency, rickerOrder );
             }
+            break;
           }
         }
-      } // end loop over all sources
+      }
+    } ); // end loop over all sources
 
 
-      // Step 2: locate the receivers, and precompute the receiver term
+    // Step 2: locate the receivers, and precompute the receiver term
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+    /// loop over all the receivers that haven't been found yet
+    forAll< EXEC_POLICY >( receiverCoordinates.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] == 0 )
       {
-        if( receiverIsLocal[ircv] == 0 )
-        {
-          real64 const coords[3] = { receiverCoordinates[ircv][0],
-                                     receiverCoordinates[ircv][1],
-                                     receiverCoordinates[ircv][2] };
+        real64 const coords[3] = { receiverCoordinates[ircv][0],
+                                   receiverCoordinates[ircv][1],
+                                   receiverCoordinates[ircv][2] };
 
+        for( localIndex const k : receiverElems[ircv] )
+        {
+          real64 const center[3] = { elemCenter[k][0],
+                                     elemCenter[k][1],
+                                     elemCenter[k][2] };
           real64 coordsOnRefElem[3]{};
           bool const receiverFound =
             computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
@@ -251,11 +300,11 @@ struct PrecomputeSourceAndReceiverKernel
               receiverNodeIds[ircv][a] = elemsToNodes[k][a];
               receiverConstants[ircv][a] = Ntest[a];
             }
+            break;
           }
         }
-      } // end loop over receivers
-
-    } );
+      }
+    } ); // end loop over receivers
 
   }
 };
@@ -22,6 +22,10 @@
 #include "mainInterface/initialization.hpp"
 #include "functions/FunctionManager.hpp"
 #include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseKernels.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
 
 // TPL includes
 #include <gtest/gtest.h>
@@ -1062,6 +1066,185 @@ TEST_F( CO2BrinePhillipsFluidTest, numericalDerivativesMass )
   }
 }
 
+TEST_F( CO2BrinePhillipsFluidTest, updateBatchMatchesUpdate )
+{
+  localIndex const batchSize = CO2BrinePhillipsFluid::KernelWrapper::batchSize;
+  localIndex const numElems = batchSize + 5;
+
+  array1d< real64 > P( numElems );
+  array1d< real64 > T( numElems );
+  array2d< real64, compflow::LAYOUT_COMP > comp( numElems, 2 );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    P[k] = 5e6 + 4e5 * k;
+    T[k] = 367.65 + 0.05 * k;
+    comp[k][0] = 0.1 + 0.02 * k;
+    comp[k][1] = 1.0 - comp[k][0];
+  }
+
+  // the reference fluid is updated one cell at a time, the copy by batches
+  parent.resize( numElems );
+  std::unique_ptr< ConstitutiveBase > fluidCopyPtr = fluid->deliverClone( "fluidCopy", &parent );
+  CO2BrinePhillipsFluid & fluidCopy = dynamicCast< CO2BrinePhillipsFluid & >( *fluidCopyPtr );
+
+  fluid->allocateConstitutiveData( fluid->getParent(), 1 );
+  fluidCopy.allocateConstitutiveData( fluid->getParent(), 1 );
+
+  auto const gatherFluidState = []( MultiFluidBase const & f )
+  {
+    std::vector< real64 > state;
+    auto const append = [&state]( auto const & view )
+    {
+      state.insert( state.end(), view.data(), view.data() + view.size() );
+    };
+    append( f.phaseFraction() );
+    append( f.dPhaseFraction() );
+    append( f.phaseDensity() );
+    append( f.dPhaseDensity() );
+    append( f.phaseMassDensity() );
+    append( f.dPhaseMassDensity() );
+    append( f.phaseViscosity() );
+    append( f.dPhaseViscosity() );
+    append( f.phaseCompFraction() );
+    append( f.dPhaseCompFraction() );
+    append( f.totalDensity() );
+    append( f.dTotalDensity() );
+    return state;
+  };
+
+  for( bool const useMass : { false, true } )
+  {
+    fluid->setMassFlag( useMass );
+    fluidCopy.setMassFlag( useMass );
+
+    CO2BrinePhillipsFluid::KernelWrapper wrapper =
+      dynamicCast< CO2BrinePhillipsFluid * >( fluid )->createKernelWrapper();
+    CO2BrinePhillipsFluid::KernelWrapper wrapperCopy = fluidCopy.createKernelWrapper();
+
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      wrapper.update( k, 0, P[k], T[k], comp[k] );
+    }
+    for( localIndex firstElem = 0; firstElem < numElems; firstElem += batchSize )
+    {
+      wrapperCopy.updateBatch( firstElem,
+                               std::min( batchSize, numElems - firstElem ),
+                               P.data() + firstElem,
+                               T.data() + firstElem,
+                               comp.toViewConst() );
+    }
+
+    std::vector< real64 > const expected = gatherFluidState( *fluid );
+    std::vector< real64 > const actual = gatherFluidState( fluidCopy );
+    ASSERT_EQ( expected.size(), actual.size() );
+    for( std::size_t i = 0; i < expected.size(); ++i )
+    {
+      EXPECT_EQ( expected[i], actual[i] );
+    }
+  }
+}
+
+TEST_F( CO2BrinePhillipsFluidTest, fluidStateUpdateMatchesUpdate )
+{
+  using FluidWrapper = CO2BrinePhillipsFluid::KernelWrapper;
+  using KernelType = compositionalMultiphaseBaseKernels::FluidStateUpdateKernel< FluidWrapper,
+                                                                                compositionalMultiphaseBaseKernels::NoOpCapPressureWrapper,
+                                                                                compositionalMultiphaseBaseKernels::NoOpCapPressureWrapper >;
+
+#if !defined( GEOSX_USE_CUDA )
+  // CompositionalMultiphaseBase::updateFluidState launches the fused kernel with parallelDevicePolicy<>,
+  // which must evaluate the fluid by batches on host
+  EXPECT_TRUE( ( compositionalMultiphaseBaseKernels::FluidUpdateKernel::UseBatchedUpdate< parallelDevicePolicy<>, FluidWrapper >::value ) );
+#endif
+
+  integer const numComp = 2;
+  integer const numPhase = 2;
+  localIndex const numElems = FluidWrapper::batchSize + 5;
+
+  parent.resize( numElems );
+  std::unique_ptr< ConstitutiveBase > fluidCopyPtr = fluid->deliverClone( "fluidCopy", &parent );
+  CO2BrinePhillipsFluid & fluidCopy = dynamicCast< CO2BrinePhillipsFluid & >( *fluidCopyPtr );
+
+  fluid->allocateConstitutiveData( fluid->getParent(), 1 );
+  fluidCopy.allocateConstitutiveData( fluid->getParent(), 1 );
+
+  // the subregion holds the primary variables read by the fused kernel
+  CellElementSubRegion subRegion( "subRegion", &parent );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::pressure >( "test" );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::deltaPressure >( "test" );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::temperature >( "test" );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::globalCompDensity >( "test" ).
+    reference().resizeDimension< 1 >( numComp );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >( "test" ).
+    reference().resizeDimension< 1 >( numComp );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::globalCompFraction >( "test" ).
+    reference().resizeDimension< 1 >( numComp );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::dGlobalCompFraction_dGlobalCompDensity >( "test" ).
+    reference().resizeDimension< 1, 2 >( numComp, numComp );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >( "test" ).
+    reference().resizeDimension< 1 >( numPhase );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::dPhaseVolumeFraction_dPressure >( "test" ).
+    reference().resizeDimension< 1 >( numPhase );
+  subRegion.registerExtrinsicData< extrinsicMeshData::flow::dPhaseVolumeFraction_dGlobalCompDensity >( "test" ).
+    reference().resizeDimension< 1, 2 >( numPhase, numComp );
+  subRegion.resize( numElems );
+
+  arrayView1d< real64 > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  arrayView1d< real64 > const dPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >();
+  arrayView1d< real64 > const temp = subRegion.getExtrinsicData< extrinsicMeshData::flow::temperature >();
+  arrayView2d< real64, compflow::USD_COMP > const compDens =
+    subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >();
+  arrayView2d< real64, compflow::USD_COMP > const compFrac =
+    subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompFraction >();
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    pres[k] = 5e6 + 4e5 * k;
+    dPres[k] = 1e4;
+    temp[k] = 367.65 + 0.05 * k;
+    compFrac[k][0] = 0.1 + 0.02 * k;
+    compFrac[k][1] = 1.0 - compFrac[k][0];
+    compDens[k][0] = 1e3 * compFrac[k][0];
+    compDens[k][1] = 1e3 * compFrac[k][1];
+  }
+
+  // the reference fluid is updated one cell at a time, the copy by the fused kernel
+  FluidWrapper wrapper = dynamicCast< CO2BrinePhillipsFluid * >( fluid )->createKernelWrapper();
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    wrapper.update( k, 0, pres[k] + dPres[k], temp[k], compFrac[k] );
+  }
+
+  KernelType kernel( numComp, numPhase, subRegion, fluidCopy,
+                     fluidCopy.createKernelWrapper(),
+                     compositionalMultiphaseBaseKernels::NoOpCapPressureWrapper{},
+                     compositionalMultiphaseBaseKernels::NoOpCapPressureWrapper{} );
+  KernelType::launch< parallelHostPolicy >( numElems, kernel );
+
+  auto const checkEqual = []( auto const & expected, auto const & actual )
+  {
+    ASSERT_EQ( expected.size(), actual.size() );
+    for( localIndex i = 0; i < expected.size(); ++i )
+    {
+      EXPECT_EQ( expected.data()[i], actual.data()[i] );
+    }
+  };
+  checkEqual( fluid->phaseFraction(), fluidCopy.phaseFraction() );
+  checkEqual( fluid->dPhaseFraction(), fluidCopy.dPhaseFraction() );
+  checkEqual( fluid->phaseDensity(), fluidCopy.phaseDensity() );
+  checkEqual( fluid->dPhaseDensity(), fluidCopy.dPhaseDensity() );
+  checkEqual( fluid->phaseViscosity(), fluidCopy.phaseViscosity() );
+  checkEqual( fluid->phaseCompFraction(), fluidCopy.phaseCompFraction() );
+  checkEqual( fluid->totalDensity(), fluidCopy.totalDensity() );
+
+  // the phase volume fractions are computed for every element, including the last, incomplete batch
+  arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+    subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >();
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    EXPECT_GT( phaseVolFrac[k][0] + phaseVolFrac[k][1], 0.0 );
+  }
+}
+
 MultiFluidBase & makeCO2BrineEzrokhiFluid( string const & name, Group * parent )
 {
   CO2BrineEzrokhiFluid & fluid = parent->registerGroup< CO2BrineEzrokhiFluid >( name );
@@ -989,6 +989,9 @@ TEST_F( RelPermTest, numericalDerivatives_TableRelPermHysteresisTwoPhase )
   auto & phaseMaxHistoricalVolFraction =
     m_model->getReference< array2d< real64, compflow::LAYOUT_PHASE > >( extrinsicMeshData::relperm::phaseMaxHistoricalVolFraction::key() );
   phaseMaxHistoricalVolFraction.move( LvArray::MemorySpace::host, false );
+  auto & scanningCurveParams =
+    m_model->getReference< array3d< real64 > >( TableRelativePermeabilityHysteresis::viewKeyStruct::scanningCurveParametersString() );
+  scanningCurveParams.move( LvArray::MemorySpace::host, false );
 
   while( sat[0] <= endSat )
   {
@@ -274,11 +274,19 @@ void testValuesAgainstReference( TBL_WRAPPER const & relpermTblWrapper,
   StackArray< real64, 4, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES *constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
               relperm::LAYOUT_RELPERM_DS > dPhaseRelPerm_dPhaseVolFrac( 1, 1, numPhases, numPhases );
 
+  integer constexpr numParams = TableRelativePermeabilityHysteresis::ScanningCurveParamType::NUM_PARAMS;
+  stackArray3d< real64, 2 * numParams > scanningCurveParams( 1, 2, numParams );
+
+  relpermTblWrapper.computeScanningCurves( phaseMaxHistoricalVolFraction[0],
+                                           phaseMinHistoricalVolFraction[0],
+                                           scanningCurveParams[0] );
+
   relpermTblWrapper.computeTwoPhase( ipWetting,
                                      ipNonWetting,
                                      phaseVolFraction[0],
                                      phaseMaxHistoricalVolFraction[0],
                                      phaseMinHistoricalVolFraction[0],
+                                     scanningCurveParams[0].toSliceConst(),
                                      phaseRelPerm[0][0],
                                      dPhaseRelPerm_dPhaseVolFrac[0][0] );
 
@@ -349,6 +357,71 @@ TEST_F( KilloughHysteresisTest, KilloughTwoPhaseHysteresisTest )
   }
 }
 
+TEST_F( KilloughHysteresisTest, KilloughTwoPhaseHysteresisNoScanningCurveTest )
+{
+  using SCP = TableRelativePermeabilityHysteresis::ScanningCurveParamType;
+
+  initialize( makeTableRelPermHysteresisTwoPhase( "relPerm", m_parent ) );
+  auto relpermTblWrapper = m_model->createKernelWrapper();
+
+  integer const numPhases = 2;
+  integer const ipWetting = 0;
+  integer const ipNonWetting = 1;
+
+  // brine-saturated and gas-free cell, as at initialization: Sw = Smxd = 1 and Sg = Scrd = 0,
+  // so that the historical volume fractions are at the bounds of the imbibition range
+  StackArray< real64, 2, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
+              compflow::LAYOUT_PHASE > phaseVolFraction( 1, numPhases );
+  phaseVolFraction[0][ipWetting] = 1.0;
+  phaseVolFraction[0][ipNonWetting] = 0.0;
+
+  StackArray< real64, 2, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
+              compflow::LAYOUT_PHASE > phaseMaxHistoricalVolFraction( 1, numPhases );
+  phaseMaxHistoricalVolFraction[0][ipWetting] = 1.0;
+  phaseMaxHistoricalVolFraction[0][ipNonWetting] = 0.0;
+
+  StackArray< real64, 2, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
+              compflow::LAYOUT_PHASE > phaseMinHistoricalVolFraction( 1, numPhases );
+  phaseMinHistoricalVolFraction[0][ipWetting] = 1.0;
+  phaseMinHistoricalVolFraction[0][ipNonWetting] = 0.0;
+
+  StackArray< real64, 3, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
+              relperm::LAYOUT_RELPERM > phaseRelPerm( 1, 1, numPhases );
+
+  StackArray< real64, 4, constitutive::RelativePermeabilityBase::MAX_NUM_PHASES *constitutive::RelativePermeabilityBase::MAX_NUM_PHASES,
+              relperm::LAYOUT_RELPERM_DS > dPhaseRelPerm_dPhaseVolFrac( 1, 1, numPhases, numPhases );
+
+  integer constexpr numParams = SCP::NUM_PARAMS;
+  stackArray3d< real64, 2 * numParams > scanningCurveParams( 1, 2, numParams );
+
+  // no scanning curve (and no division by zero) for either phase
+  relpermTblWrapper.computeScanningCurves( phaseMaxHistoricalVolFraction[0],
+                                           phaseMinHistoricalVolFraction[0],
+                                           scanningCurveParams[0] );
+  for( integer ip = 0; ip < 2; ++ip )
+  {
+    EXPECT_FALSE( relpermTblWrapper.hasScanningCurve( scanningCurveParams[0][ip].toSliceConst() ) );
+    for( integer iParam = 0; iParam < numParams; ++iParam )
+    {
+      EXPECT_TRUE( std::isfinite( scanningCurveParams[0][ip][iParam] ) );
+    }
+  }
+
+  // the drainage relperms are used
+  relpermTblWrapper.computeTwoPhase( ipWetting,
+                                     ipNonWetting,
+                                     phaseVolFraction[0],
+                                     phaseMaxHistoricalVolFraction[0],
+                                     phaseMinHistoricalVolFraction[0],
+                                     scanningCurveParams[0].toSliceConst(),
+                                     phaseRelPerm[0][0],
+                                     dPhaseRelPerm_dPhaseVolFrac[0][0] );
+
+  real64 const relTol = 5e-5;
+  checkRelativeError( phaseRelPerm[0][0][ipWetting], 1.0, relTol );
+  checkRelativeError( phaseRelPerm[0][0][ipNonWetting], 0.0, relTol );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,105 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "finiteVolume/SurfaceElementStencil.hpp"
+#include "mainInterface/initialization.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+/**
+ * @brief Add the connection of a fracture connector (edge) between face elements, as done by
+ *        TwoPointFluxApproximation::addToFractureStencil
+ * @param[inout] stencil the fracture stencil
+ * @param[in] connectorIndex the index of the connector, which identifies the connection
+ * @param[in] elems the indices of the face elements attached to the connector
+ */
+void addConnection( SurfaceElementStencil & stencil,
+                    localIndex const connectorIndex,
+                    std::vector< localIndex > const & elems )
+{
+  localIndex const numElems = LvArray::integerConversion< localIndex >( elems.size() );
+  std::vector< localIndex > const regionIndices( numElems, 0 );
+  std::vector< localIndex > const subRegionIndices( numElems, 0 );
+  std::vector< real64 > weights( numElems );
+  std::vector< R1Tensor > cellCenterToEdgeCenters( numElems );
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    weights[i] = 1.0 / numElems;
+    cellCenterToEdgeCenters[i][0] = static_cast< real64 >( elems[i] );
+    cellCenterToEdgeCenters[i][1] = 0.0;
+    cellCenterToEdgeCenters[i][2] = 0.0;
+  }
+
+  stencil.add( numElems, regionIndices.data(), subRegionIndices.data(), elems.data(), weights.data(), connectorIndex );
+  stencil.add( numElems, cellCenterToEdgeCenters.data(), connectorIndex );
+}
+
+TEST( SurfaceElementStencil, newConnectorsAreAppended )
+{
+  SurfaceElementStencil stencil;
+  addConnection( stencil, 7, { 0, 1 } );
+  addConnection( stencil, 3, { 1, 2 } );
+
+  ASSERT_EQ( stencil.size(), 2 );
+  ASSERT_EQ( stencil.getCellCenterToEdgeCenters().size(), 2 );
+  EXPECT_EQ( stencil.stencilSize( 0 ), 2 );
+  EXPECT_EQ( stencil.stencilSize( 1 ), 2 );
+  EXPECT_EQ( stencil.getElementIndices()[1][0], 1 );
+  EXPECT_EQ( stencil.getElementIndices()[1][1], 2 );
+}
+
+TEST( SurfaceElementStencil, existingConnectorIsUpdatedInPlace )
+{
+  SurfaceElementStencil stencil;
+  addConnection( stencil, 7, { 0, 1 } );
+  addConnection( stencil, 3, { 1, 2 } );
+
+  // the connector 7 gains a face element when the fracture propagates: its connection is replaced,
+  // and no duplicate connection (which would count the flux across the connector twice) is added
+  addConnection( stencil, 7, { 0, 1, 3 } );
+
+  ASSERT_EQ( stencil.size(), 2 );
+  ASSERT_EQ( stencil.getCellCenterToEdgeCenters().size(), 2 );
+
+  ASSERT_EQ( stencil.stencilSize( 0 ), 3 );
+  for( localIndex i = 0; i < 3; ++i )
+  {
+    EXPECT_DOUBLE_EQ( stencil.getWeights()[0][i], 1.0 / 3.0 );
+  }
+  EXPECT_EQ( stencil.getElementIndices()[0][2], 3 );
+  ASSERT_EQ( stencil.getCellCenterToEdgeCenters().sizeOfArray( 0 ), 3 );
+  EXPECT_DOUBLE_EQ( stencil.getCellCenterToEdgeCenters()[0][2][0], 3.0 );
+
+  // the other connection is untouched
+  ASSERT_EQ( stencil.stencilSize( 1 ), 2 );
+  EXPECT_EQ( stencil.getElementIndices()[1][0], 1 );
+  EXPECT_EQ( stencil.getElementIndices()[1][1], 2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
@@ -196,6 +196,64 @@ TEST( FunctionTests, 1DTable )
 
 
 
+TEST( FunctionTests, 1DTable_evenlySpaced )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // 1D table on an evenly spaced axis (direct interval lookup), f(x) = x^2 at the vertices
+  // The axis vertices are not exactly representable, so that round-off in the lookup is exercised
+  localIndex const Naxis = 11;
+  real64 const dx = 0.1;
+
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  real64_array values( Naxis );
+  for( localIndex i = 0; i < Naxis; ++i )
+  {
+    coordinates[0][i] = i * dx;
+    values[i] = coordinates[0][i] * coordinates[0][i];
+  }
+
+  TableFunction & table_evenlySpaced = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_evenlySpaced" ) );
+  table_evenlySpaced.setTableCoordinates( coordinates );
+  table_evenlySpaced.setTableValues( values );
+  table_evenlySpaced.reInitializeFunction();
+
+  // Test at the midpoints and at the interior vertices of the axis
+  localIndex const Ntest = 2 * ( Naxis - 1 );
+  real64_array testCoordinates( Ntest );
+  real64_array testExpectedLinear( Ntest );
+  real64_array testExpectedUpper( Ntest );
+  real64_array testExpectedLower( Ntest );
+  for( localIndex i = 0; i < Naxis - 1; ++i )
+  {
+    testCoordinates[2*i] = 0.5 * ( coordinates[0][i] + coordinates[0][i+1] );
+    testExpectedLinear[2*i] = 0.5 * ( values[i] + values[i+1] );
+    testExpectedUpper[2*i] = values[i+1];
+    testExpectedLower[2*i] = values[i];
+
+    // at a vertex, the interval is the one on the left, as with the binary search on a generic axis
+    localIndex const iv = LvArray::math::max( i, localIndex( 1 ) );
+    testCoordinates[2*i+1] = coordinates[0][iv];
+    testExpectedLinear[2*i+1] = values[iv];
+    testExpectedUpper[2*i+1] = values[iv];
+    testExpectedLower[2*i+1] = values[iv-1];
+  }
+
+  table_evenlySpaced.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  table_evenlySpaced.reInitializeFunction();
+  evaluate1DFunction( table_evenlySpaced, testCoordinates, testExpectedLinear );
+
+  table_evenlySpaced.setInterpolationMethod( TableFunction::InterpolationType::Upper );
+  table_evenlySpaced.reInitializeFunction();
+  evaluate1DFunction( table_evenlySpaced, testCoordinates, testExpectedUpper );
+
+  table_evenlySpaced.setInterpolationMethod( TableFunction::InterpolationType::Lower );
+  table_evenlySpaced.reInitializeFunction();
+  evaluate1DFunction( table_evenlySpaced, testCoordinates, testExpectedLower );
+}
+
 TEST( FunctionTests, 2DTable )
 {
   FunctionManager * functionManager = &FunctionManager::getInstance();
@@ -23,6 +23,7 @@
 #include "mesh/NodeManager.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/CellElementSubRegion.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 
 
 using namespace geosx;
@@ -197,6 +198,62 @@ TEST_F( MeshGenerationTest, elementCentersAndVolumes )
   }
 }
 
+TEST_F( MeshGenerationTest, elementSpatialIndex )
+{
+  MeshLevel const & mesh = getGlobalState().getProblemManager().getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 );
+  ElementSpatialIndex const elemIndex( mesh );
+  EXPECT_EQ( elemIndex.numElements(), m_subRegion->size() );
+
+  // the bounding box of an element contains its center, and no other element has this property
+  localIndex elemID = 0;
+  for( localIndex i = 0; i < numElemsInX; ++i )
+  {
+    for( localIndex j = 0; j < numElemsInY; ++j )
+    {
+      for( localIndex k = 0; k < numElemsInZ; ++k )
+      {
+        real64 const center[3] = { i * dx + dx / 2.0, j * dy + dy / 2.0, k * dz + dz / 2.0 };
+        std::vector< localIndex > found;
+        elemIndex.forElementsContainingPoint( center, [&]( localIndex const er, localIndex const esr, localIndex const ei )
+        {
+          EXPECT_EQ( er, 0 );
+          EXPECT_EQ( esr, 0 );
+          found.emplace_back( ei );
+        } );
+        ASSERT_EQ( found.size(), 1u );
+        EXPECT_EQ( found[0], elemID );
+        ++elemID;
+      }
+    }
+  }
+
+  // a box strictly inside a 2x2x2 block of elements
+  real64 const boxMin[3] = { 1.5 * dx, 1.5 * dy, 1.5 * dz };
+  real64 const boxMax[3] = { 2.5 * dx, 2.5 * dy, 2.5 * dz };
+  localIndex numFound = 0;
+  localIndex previous = -1;
+  elemIndex.forElementsIntersectingBox( boxMin, boxMax, [&]( localIndex const, localIndex const, localIndex const ei )
+  {
+    EXPECT_GT( ei, previous );
+    previous = ei;
+    ++numFound;
+  } );
+  EXPECT_EQ( numFound, 8 );
+
+  // the plane x = 0.5 * dx only crosses the first layer of elements
+  real64 const normal[3] = { 1.0, 0.0, 0.0 };
+  real64 const origin[3] = { 0.5 * dx, 0.0, 0.0 };
+  real64 const domainMin[3] = { 0.0, 0.0, 0.0 };
+  real64 const domainMax[3] = { MAX_COORD_X, MAX_COORD_Y, MAX_COORD_Z };
+  numFound = 0;
+  elemIndex.forElementsCrossingPlane( normal, origin, domainMin, domainMax, [&]( localIndex const, localIndex const, localIndex const ei )
+  {
+    EXPECT_LT( ei, elem_dI );
+    ++numFound;
+  } );
+  EXPECT_EQ( numFound, elem_dI );
+}
+
 TEST_F( MeshGenerationTest, elemToNodeMap )
 {
   arrayView2d< localIndex const, cells::NODE_MAP_USD > const & nodeMap = m_subRegion->nodeList();
@@ -62,6 +62,9 @@
 /// Enables use of PETSc library (CMake option ENABLE_PETSC)
 #define GEOSX_USE_PETSC
 
+/// Enables use of ParMETIS library (CMake option ENABLE_PARMETIS)
+#define GEOSX_USE_PARMETIS
+
 /// Choice of global linear algebra interface (CMake option GEOSX_LA_INTERFACE)
 #define GEOSX_LA_INTERFACE Hypre
 /// Macro defined when Trilinos interface is selected
@@ -71,6 +74,9 @@
 /// Macro defined when PETSc interface is selected
 /* #undef GEOSX_LA_INTERFACE_PETSC */
 
+/// Macro defined when the cell index is the unit-stride dimension of the multiphase fluid arrays
+/// on host builds (CMake option GEOSX_MULTIFLUID_LAYOUT)
+/* #undef GEOSX_MULTIFLUID_LAYOUT_CELL_INNER */
 
 /// Platform-dependent mangling of fortran function names (CMake option FORTRAN_MANGLE_NO_UNDERSCORE)
 #define FORTRAN_MANGLE_NO_UNDERSCORE
@@ -18,6 +18,7 @@
 #include "mainInterface/GeosxState.hpp"
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "common/TimerRegistry.hpp"
 
 // System includes
 #include <chrono>
@@ -46,6 +47,15 @@ int main( int argc, char *argv[] )
         state.applyInitialConditions();
         state.run();
         LVARRAY_WARNING_IF( state.getState() != State::COMPLETED, "Simulation exited early." );
+
+#if !defined( GEOSX_USE_CALIPER )
+        // the report is a collective, so it is only done once all the ranks have completed the run
+        if( state.getState() == State::COMPLETED && !state.getCommandLineOptions().timerOutput.empty() )
+        {
+          TimerRegistry::report();
+          TimerRegistry::clear();
+        }
+#endif
       }
 
       initTime = state.getInitTime();